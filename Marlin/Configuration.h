@@ -510,6 +510,36 @@
 
 #endif // PIDTEMP
 
+/**
+ * Model Predictive Control for hotend temperature
+ *
+ * Keep a model of the heater block, the temperature sensor and the ambient air,
+ * and set the heater power from it. The power includes a feed-forward for the
+ * heat carried off by the part cooling fan and by the filament of the moves
+ * queued in the planner, so the hotend doesn't sag when the flow ramps up.
+ *
+ * Measure the constants of a hotend with 'M306 T E<hotend>' and save them with M500.
+ * With PIDTEMP also enabled, each hotend may be switched to PID with 'M306 E<hotend> S0'.
+ */
+//#define MPCTEMP
+#if ENABLED(MPCTEMP)
+  #define MPC_MAX BANG_MAX                        // (0..255) Limits current to nozzle while MPC is active
+  #define MPC_HEATER_POWER { 40.0f }              // (W) Heater cartridge power, per hotend
+
+  // Measured constants, per hotend. Get your own with 'M306 T'.
+  #define MPC_BLOCK_HEAT_CAPACITY { 16.7f }       // (J/K) Heat capacity of the heater block
+  #define MPC_SENSOR_RESPONSIVENESS { 0.22f }     // (K/s per K) Rate of change of the sensor temperature per degree from the block
+  #define MPC_AMBIENT_XFER_COEFF { 0.068f }       // (W/K) Heat transfer from the block to the air with the fan off
+  #define MPC_AMBIENT_XFER_COEFF_FAN255 { 0.097f } // (W/K) Heat transfer from the block to the air with the fan on full
+
+  #define FILAMENT_HEAT_CAPACITY_PERMM { 5.6e-3f } // (J/K/mm) 1.75mm PLA: 5.6e-3, 1.75mm PETG: 5.6e-3, 2.85mm PLA: 1.4e-2
+
+  #define MPC_LOOKAHEAD 2.0f                      // (s) Queued moves averaged for the extrusion feed-forward
+  #define MPC_SMOOTHING_FACTOR 0.5f               // (0.0..1.0) Correction toward the measured temperature. Lower for noisy sensors.
+  #define MPC_MIN_AMBIENT_CHANGE 1.0f             // (K/s) Rate of change of the modeled ambient temperature, when correcting the model
+  #define MPC_STEADYSTATE 0.5f                    // (K/s) Below this rate of change the model is at steady state
+#endif
+
 //===========================================================================
 //====================== PID > Bed Temperature Control ======================
 //===========================================================================
@@ -635,6 +665,14 @@
   // and processor overload (too many expensive sqrt calls).
   #define DELTA_SEGMENTS_PER_SECOND 200
 
+  // Work out the tower heights for this many segments of a move at a time,
+  // stepping along the line instead of solving each point from scratch.
+  //#define DELTA_SEGMENT_BATCH 16
+
+  // Use longer segments where the towers move in nearly straight lines,
+  // keeping each carriage within this distance (mm) of its true path.
+  //#define DELTA_SEGMENT_TOLERANCE 0.01
+
   // After homing move down to a height where XY movement is unconstrained
   //#define DELTA_HOME_TO_SAFE_ZONE
 
@@ -1372,7 +1410,12 @@
   // split up moves into short segments like a Delta. This follows the
   // contours of the bed more closely than edge-to-edge straight moves.
   #define SEGMENT_LEVELED_MOVES
-  #define LEVELED_SEGMENT_LENGTH 5.0 // (mm) Length of all segments (except the last one)
+  #define LEVELED_SEGMENT_LENGTH 5.0 // (mm) Length of segments (the shortest with LEVELED_SEGMENT_TOLERANCE) except the last one
+
+  // Split a move only where the mesh strays from a straight line by more than this,
+  // down to LEVELED_SEGMENT_LENGTH. Flat areas of the bed then get fewer segments.
+  // With UBL on a Cartesian machine, mesh line crossings are merged the same way.
+  //#define LEVELED_SEGMENT_TOLERANCE 0.005 // (mm)
 
   /**
    * Enable the G26 Mesh Validation Pattern tool.
@@ -1415,6 +1458,14 @@
       #define BILINEAR_SUBDIVISIONS 3
     #endif
 
+    //
+    // Keep each grid cell as z = a + bx + cy + dxy for faster lookups.
+    // Uses 16 bytes of RAM per cell (or subdivided cell). With subdivision it
+    // replaces the 4-byte subdivided grid points, so the net cost is about 12
+    // bytes per subdivided cell.
+    //
+    //#define ABL_BILINEAR_CELL_CACHE
+
   #endif
 
 #elif ENABLED(AUTO_BED_LEVELING_UBL)
@@ -1588,6 +1639,7 @@
 #define EEPROM_BOOT_SILENT    // Keep M503 quiet and only give errors during first load
 #if ENABLED(EEPROM_SETTINGS)
   //#define EEPROM_AUTO_INIT  // Init EEPROM automatically on any errors.
+  //#define EEPROM_JOURNAL    // Save only changed bytes, appended to the stored image. (LINUX)
 #endif
 
 //
@@ -2461,6 +2513,22 @@
   // Use a single NeoPixel LED for static (background) lighting
   //#define NEOPIXEL_BKGD_LED_INDEX  0               // Index of the LED to use
   //#define NEOPIXEL_BKGD_COLOR { 255, 255, 255, 0 } // R, G, B, W
+
+  // Stage color changes in a frame buffer and refresh the strip from idle()
+  // instead of on every change. Strip refreshes block interrupts, so long strips
+  // benefit the most. M150 then only updates memory.
+  //#define NEOPIXEL_DEFERRED_SHOW
+  #if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+    #define NEOPIXEL_FRAME_MS            20 // (ms) Minimum time between strip refreshes
+    #define NEOPIXEL_MIN_PLANNED_BLOCKS   4 // Hold off refreshes while moves are running with fewer blocks queued
+
+    // Animated effects selected with M151: Print progress, hotend heat, breathing
+    //#define NEOPIXEL_EFFECTS
+    #if ENABLED(NEOPIXEL_EFFECTS)
+      #define NEOPIXEL_EFFECTS_FRAME_MS  50 // (ms) Time between effect frames
+      #define NEOPIXEL_BREATHE_MS      3000 // (ms) Period of the breathing effect
+    #endif
+  #endif
 #endif
 
 /**
@@ -115,6 +115,19 @@
   #define CHAMBER_BETA                 3950    // Beta value
 #endif
 
+/**
+ * Thermistor Lookup Table
+ * Convert thermistor readings with a lookup table indexed by the raw value,
+ * instead of searching the thermistor table or evaluating the Steinhart-Hart
+ * equation on every reading. Tables for built-in thermistors are filled at
+ * startup, and for custom thermistors (1000) whenever M305 changes them.
+ * Each thermistor uses 2 * (2^THERMISTOR_LUT_BITS + 1) bytes of RAM.
+ */
+//#define THERMISTOR_LUT
+#if ENABLED(THERMISTOR_LUT)
+  #define THERMISTOR_LUT_BITS 10  // Table intervals as a power of 2. Lower values save RAM but lose accuracy at high temperatures.
+#endif
+
 //
 // Hephestos 2 24V heated bed upgrade kit.
 // https://store.bq.com/en/heated-bed-kit-hephestos2
@@ -953,6 +966,28 @@
  */
 //#define ADAPTIVE_STEP_SMOOTHING
 
+/**
+ * Per-axis Step Timing puts each step of the slower axes in a multi-axis move at its own exact time
+ * between the steps of the fastest axis, instead of on the nearest step of the fastest axis. Minor axis
+ * pulses are evenly spaced at the cost of up to one extra stepper ISR per minor axis step. Not used while the
+ * stepper ISR is taking multiple steps per interrupt. For 32-bit boards. An alternative to
+ * ADAPTIVE_STEP_SMOOTHING, which runs the ISR up to 8 times faster to get a similar effect.
+ */
+//#define PER_AXIS_STEP_TIMING
+
+/**
+ * Step Interval Tables
+ * Work out the stepper timer intervals of each block's acceleration and deceleration ramps while
+ * the block waits in the planner buffer, so the stepper ISR reads them from a table instead of
+ * doing the rate math (or the S-Curve evaluation) on every interrupt. Ramps longer than the table
+ * are finished the usual way. Costs 8 * STEP_INTERVAL_TABLE_SIZE bytes of RAM per block.
+ * For 32-bit boards.
+ */
+//#define STEP_INTERVAL_TABLE
+#if ENABLED(STEP_INTERVAL_TABLE)
+  #define STEP_INTERVAL_TABLE_SIZE 16 // Stepper ISR intervals kept for each ramp
+#endif
+
 /**
  * Custom Microstepping
  * Override as-needed for your setup. Up to 3 MS pins are supported.
@@ -1137,6 +1172,22 @@
 
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
 
+  // Read G-code from the card in multi-block chunks and scan lines out of RAM
+  // instead of calling the filesystem for every byte. Costs SD_READ_AHEAD_SIZE bytes of RAM.
+  //#define SD_READ_AHEAD
+  #if ENABLED(SD_READ_AHEAD)
+    #define SD_READ_AHEAD_SIZE 2048         // (bytes) A multiple of 512
+  #endif
+
+  // Keep more 512-byte blocks in RAM next to the single shared block buffer:
+  // FAT blocks, so cluster lookups don't evict file data, and the file data
+  // just ahead of an SD print, read from the card during idle time.
+  //#define SD_BLOCK_CACHE
+  #if ENABLED(SD_BLOCK_CACHE)
+    #define SD_CACHE_FAT_LINES  2           // FAT blocks, least recently used is replaced first
+    #define SD_CACHE_DATA_LINES 4           // File data blocks read ahead
+  #endif
+
   #define SD_FINISHED_STEPPERRELEASE true   // Disable steppers when SD Print is finished
   #define SD_FINISHED_RELEASECOMMAND "M84"  // Use "M84XYE" to keep Z enabled so your bed stays in place
 
@@ -1295,6 +1346,9 @@
   // Add an optimized binary file transfer mode, initiated with 'M28 B1'
   //#define BINARY_FILE_TRANSFER
 
+  // Also accept bulk NeoPixel frames over the binary protocol (requires NEOPIXEL_LED)
+  //#define BINARY_NEOPIXEL_TRANSFER
+
   /**
    * Set this option to one of the following (or the board's defaults apply):
    *
@@ -1767,6 +1821,7 @@
   #define N_ARC_CORRECTION       25 // Number of interpolated segments between corrections
   //#define ARC_P_CIRCLES           // Enable the 'P' parameter to specify complete circles
   //#define CNC_WORKSPACE_PLANES    // Allow G2/G3 to operate in XY, ZX, or YZ planes
+  //#define ARC_BLOCKS              // Queue each XY arc as one block, with the stepper running its segments (32-bit only)
 #endif
 
 // Support for G5 with XYZE destination and IJPQ offsets. Requires ~2666 bytes.
@@ -1854,6 +1909,7 @@
 
 // The number of linear moves that can be in the planner at once.
 // The value of BLOCK_BUFFER_SIZE must be a power of 2 (e.g. 8, 16, 32)
+// On 32-bit boards 64 or 128 gives more lookahead for fast, short segments.
 #if BOTH(SDSUPPORT, DIRECT_STEPPING)
   #define BLOCK_BUFFER_SIZE  8
 #elif ENABLED(SDSUPPORT)
@@ -1862,12 +1918,31 @@
   #define BLOCK_BUFFER_SIZE 16
 #endif
 
+/**
+ * Work out the acceleration trapezoids in integer math.
+ * Replaces the float SQRT and divides done for every replanned block
+ * with an integer square root. For 32-bit boards without an FPU.
+ */
+//#define PLANNER_FIXED_POINT
+
 // @section serial
 
 // The ASCII buffer for serial input
 #define MAX_CMD_SIZE 96
 #define BUFSIZE 4
 
+/**
+ * Pack queued commands end to end in a ring of COMMAND_QUEUE_BYTES
+ * instead of a MAX_CMD_SIZE slot for each one. BUFSIZE then only limits
+ * the number of queued commands, so it can be raised for the same RAM.
+ * With ADVANCED_OK the free count (B) is the number of full-length
+ * commands that are sure to fit.
+ */
+//#define PACKED_COMMAND_QUEUE
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  #define COMMAND_QUEUE_BYTES 384   // (bytes) Room for 4 commands of MAX_CMD_SIZE
+#endif
+
 // Transmission to Host Buffer Size
 // To save 386 bytes of PROGMEM (and TX_BUFFER_SIZE+3 bytes of RAM) set to 0.
 // To buffer a simple "ok" you need 4 bytes.
@@ -3146,6 +3221,7 @@
 
 #if ENABLED(FASTER_GCODE_PARSER)
   //#define GCODE_QUOTED_STRINGS  // Support for quoted string parameters
+  //#define FASTER_GCODE_VALUES   // Spend 131 bytes of SRAM to convert parameter values once, while parsing
 #endif
 
 #define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
@@ -50,6 +50,8 @@ uint8_t _getc();
 #define B10 2
 
 #include "hardware/Clock.h"
+#include "hardware/GpioTrace.h"
+#include "hardware/Benchmark.h"
 
 #include "../shared/Marduino.h"
 #include "../shared/math_32bit.h"
@@ -79,6 +81,18 @@ extern HalSerial usb_serial;
 
 inline void HAL_init() {}
 
+#define HAL_IDLETASK 1
+void HAL_idletask();
+
+// Stepper timing instrumentation, recorded with --gpio-trace
+#define HAL_STEPPER_TRACE_BLOCK(B)  GpioTrace::block(B)
+#define HAL_STEPPER_TRACE_OVERRUN() GpioTrace::marker(GpioTrace::EVENT_ISR_OVERRUN, 0, 1)
+
+// Planner timing, reported with --bench
+#define HAL_PLANNER_BENCH_BEGIN()   Benchmark::planBegin()
+#define HAL_PLANNER_BENCH_END(Q)    Benchmark::planEnd(Q)
+#define HAL_PLANNER_BENCH_SYNC()    Benchmark::planSync()
+
 // Utility functions
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-function"
@@ -36,6 +36,8 @@ void _delay_ms(const int delay_ms) {
 }
 
 uint32_t millis() {
+  // In virtual time each read costs 1µs so loops polling for a timeout still end
+  if (Clock::virtualTime()) Clock::wait(1000);
   return (uint32_t)Clock::millis();
 }
 
@@ -35,6 +35,99 @@
 uint8_t buffer[MARLIN_EEPROM_SIZE];
 char filename[] = "eeprom.dat";
 
+#if ENABLED(EEPROM_JOURNAL)
+
+  /**
+   * The file holds a full image followed by a journal of changes.
+   * A save appends records with only the bytes changed since the last
+   * save. A load replays the records over the image. When the journal
+   * is full the next save compacts the file back to a single image.
+   * The last record of each save is flagged, and a save is only applied
+   * once all of its records are read, so a save cut short by a crash is
+   * ignored as a whole.
+   */
+  #ifndef EEPROM_JOURNAL_SIZE
+    #define EEPROM_JOURNAL_SIZE MARLIN_EEPROM_SIZE
+  #endif
+
+  typedef struct { uint16_t pos, size, crc; } journal_record_t;
+
+  #define JOURNAL_LAST 0x8000               // Flag in size for the last record of a save
+  static_assert(MARLIN_EEPROM_SIZE < JOURNAL_LAST, "EEPROM_JOURNAL requires MARLIN_EEPROM_SIZE under 32K.");
+
+  static uint8_t saved[MARLIN_EEPROM_SIZE]; // The data as it is in the file
+  static long journal_end;                  // File offset for the next record, 0 for no image
+
+  static uint16_t journal_crc(const journal_record_t &rec, const uint8_t *data) {
+    uint16_t crc = 0;
+    crc16(&crc, &rec, 2 * sizeof(uint16_t)); // pos and size
+    crc16(&crc, data, rec.size & ~JOURNAL_LAST);
+    return crc;
+  }
+
+  // Apply whole saves over the image and set journal_end after the last one
+  static void journal_replay(FILE * const eeprom_file) {
+    long end = journal_end = MARLIN_EEPROM_SIZE;
+    uint8_t image[MARLIN_EEPROM_SIZE];
+    memcpy(image, buffer, sizeof(image));
+    journal_record_t rec;
+    while (fread(&rec, sizeof(rec), 1, eeprom_file) == 1) {
+      const uint16_t size = rec.size & ~JOURNAL_LAST;
+      if (!size || size > MARLIN_EEPROM_SIZE - rec.pos
+        || fread(&image[rec.pos], sizeof(uint8_t), size, eeprom_file) != size
+        || rec.crc != journal_crc(rec, &image[rec.pos])
+      ) break;
+      end += sizeof(rec) + size;
+      if (rec.size & JOURNAL_LAST) {
+        memcpy(buffer, image, sizeof(image));
+        journal_end = end;
+      }
+    }
+  }
+
+  // Find the next run of changes at or after pos. Runs closer than a record header are merged.
+  static bool next_change(uint16_t &pos, uint16_t &size) {
+    while (pos < MARLIN_EEPROM_SIZE && buffer[pos] == saved[pos]) pos++;
+    if (pos >= MARLIN_EEPROM_SIZE) return false;
+    uint16_t end = pos + 1;
+    for (uint16_t i = end; i < MARLIN_EEPROM_SIZE && size_t(i - end) <= sizeof(journal_record_t); i++)
+      if (buffer[i] != saved[i]) end = i + 1;
+    size = end - pos;
+    return true;
+  }
+
+  // Bytes needed to append all changes
+  static long journal_needed() {
+    long needed = 0;
+    for (uint16_t pos = 0, size; next_change(pos, size); pos += size)
+      needed += sizeof(journal_record_t) + size;
+    return needed;
+  }
+
+  // Append a record for each run of changes. The journal only grows once the whole save is written.
+  static bool journal_append(FILE * const eeprom_file) {
+    long end = journal_end;
+    if (fseek(eeprom_file, end, SEEK_SET)) return false;
+    uint16_t pos = 0, size;
+    for (bool more = next_change(pos, size); more;) {
+      uint16_t next_pos = pos + size, next_size;
+      more = next_change(next_pos, next_size);
+      journal_record_t rec = { pos, uint16_t(more ? size : size | JOURNAL_LAST), 0 };
+      rec.crc = journal_crc(rec, &buffer[pos]);
+      if (fwrite(&rec, sizeof(rec), 1, eeprom_file) != 1
+        || fwrite(&buffer[pos], sizeof(uint8_t), size, eeprom_file) != size
+      ) return false;
+      end += sizeof(rec) + size;
+      pos = next_pos;
+      size = next_size;
+    }
+    if (fflush(eeprom_file)) return false;
+    journal_end = end;
+    return true;
+  }
+
+#endif // EEPROM_JOURNAL
+
 size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE; }
 
 bool PersistentStore::access_start() {
@@ -51,18 +144,45 @@ bool PersistentStore::access_start() {
   else {
     fseek(eeprom_file, 0L, SEEK_SET);
     fread(buffer, sizeof(uint8_t), sizeof(buffer), eeprom_file);
+    TERN_(EEPROM_JOURNAL, journal_replay(eeprom_file));
   }
 
   fclose(eeprom_file);
+
+  #if ENABLED(EEPROM_JOURNAL)
+    if (file_size < MARLIN_EEPROM_SIZE) journal_end = 0;
+    memcpy(saved, buffer, sizeof(saved));
+  #endif
+
   return true;
 }
 
 bool PersistentStore::access_finish() {
+  #if ENABLED(EEPROM_JOURNAL)
+    if (!memcmp(saved, buffer, sizeof(buffer))) return true;  // Nothing changed
+    if (journal_end && journal_end + journal_needed() <= MARLIN_EEPROM_SIZE + EEPROM_JOURNAL_SIZE) {
+      FILE * eeprom_file = fopen(filename, "r+b");
+      if (eeprom_file != nullptr) {
+        const bool ok = journal_append(eeprom_file);
+        if (fclose(eeprom_file) == 0 && ok) {
+          memcpy(saved, buffer, sizeof(saved));
+          return true;
+        }
+      }
+      // A partial save must not be merged into the next one. Compact instead.
+    }
+    // No image yet, the journal is full, or appending failed. Compact to a single image.
+  #endif
   FILE * eeprom_file = fopen(filename, "wb");
   if (eeprom_file == nullptr) return false;
-  fwrite(buffer, sizeof(uint8_t), sizeof(buffer), eeprom_file);
+  const bool ok = fwrite(buffer, sizeof(uint8_t), sizeof(buffer), eeprom_file) == sizeof(buffer);
   fclose(eeprom_file);
-  return true;
+  #if ENABLED(EEPROM_JOURNAL)
+    // Without a whole image the next save has to compact again
+    journal_end = ok ? MARLIN_EEPROM_SIZE : 0;
+    if (ok) memcpy(saved, buffer, sizeof(saved));
+  #endif
+  return ok;
 }
 
 bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
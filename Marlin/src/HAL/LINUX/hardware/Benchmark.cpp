@@ -0,0 +1,158 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include <string.h>
+
+#include "Benchmark.h"
+
+bool Benchmark::enabled = false,
+     Benchmark::starved = false,
+     Benchmark::had_blocks = false,
+     Benchmark::draining = false;
+float Benchmark::cpu_scale = 0;
+uint64_t Benchmark::plan_start = 0,
+         Benchmark::host_start = 0,
+         Benchmark::sim_start = 0,
+         Benchmark::starved_since = 0,
+         Benchmark::starved_total = 0,
+         Benchmark::underruns = 0,
+         Benchmark::dropped_moves = 0;
+Benchmark::Histogram Benchmark::plan_time, Benchmark::isr_time;
+
+uint16_t Benchmark::Histogram::bucket(const uint64_t ns) {
+  if (ns < 4) return ns;
+  const uint8_t msb = 63 - __builtin_clzll(ns);
+  const uint16_t b = 4 * (msb - 1) + ((ns >> (msb - 2)) & 3);
+  return b < buckets ? b : buckets - 1;
+}
+
+uint64_t Benchmark::Histogram::lower_bound(const uint16_t b) {
+  if (b < 4) return b;
+  return uint64_t(4 + (b & 3)) << (b / 4 - 1);
+}
+
+void Benchmark::Histogram::add(const uint64_t ns) {
+  count[bucket(ns)]++;
+  samples++;
+  total += ns;
+  if (ns > max) max = ns;
+}
+
+uint64_t Benchmark::Histogram::percentile(const float p) const {
+  const uint64_t rank = samples * p;
+  uint64_t seen = 0;
+  for (uint16_t b = 0; b < buckets; b++) {
+    seen += count[b];
+    if (seen > rank) return lower_bound(b);
+  }
+  return max;
+}
+
+// One line per power of two, so it stays readable
+void Benchmark::Histogram::print(FILE *out, const char * const indent) const {
+  uint64_t octave[buckets / 4 + 1] = { 0 }, peak = 0;
+  for (uint16_t b = 0; b < buckets; b++) octave[b / 4] += count[b];
+  for (uint16_t o = 0; o <= buckets / 4; o++) if (octave[o] > peak) peak = octave[o];
+  for (uint16_t o = 0; o <= buckets / 4; o++) {
+    if (!octave[o]) continue;
+    char range[32], bar[41];
+    snprintf(range, sizeof(range), "%llu-%llu", (unsigned long long)lower_bound(o * 4), (unsigned long long)lower_bound(o * 4 + 4));
+    const int len = 40 * octave[o] / peak;
+    memset(bar, '#', len);
+    bar[len] = '\0';
+    fprintf(out, "%s%15s ns %10llu %s\n", indent, range, (unsigned long long)octave[o], bar);
+  }
+}
+
+void Benchmark::start(const float scale) {
+  memset(&plan_time, 0, sizeof(plan_time));
+  memset(&isr_time, 0, sizeof(isr_time));
+  starved = had_blocks = draining = false;
+  cpu_scale = scale;
+  starved_total = underruns = dropped_moves = 0;
+  host_start = hostNanos();
+  sim_start = Clock::nanos();
+  enabled = true;
+}
+
+void Benchmark::planEnd(const bool queued) {
+  if (!enabled) return;
+  const uint64_t ns = hostNanos() - plan_start;
+  if (queued) {
+    plan_time.add(ns);
+    draining = false;
+    if (starved) {
+      starved = false;
+      underruns++;
+      starved_total += Clock::nanos() - starved_since;
+    }
+  }
+  else
+    dropped_moves++;
+
+  // The stepper ISRs that would have preempted the planner run now
+  if (cpu_scale > 0) Clock::wait(uint64_t(ns * cpu_scale));
+}
+
+void Benchmark::stepperIsr(const uint64_t ns, const bool has_blocks) {
+  isr_time.add(ns);
+  if (has_blocks)
+    had_blocks = true;
+  else if (had_blocks) {
+    had_blocks = false;
+    if (!draining) {
+      starved = true;
+      starved_since = Clock::nanos();
+    }
+    draining = false;
+  }
+}
+
+void Benchmark::report(FILE *out) {
+  if (!enabled) return;
+  const double host_s = (hostNanos() - host_start) / 1e9,
+               sim_s = (Clock::nanos() - sim_start) / 1e9;
+  const uint64_t blocks = plan_time.samples;
+
+  fprintf(out, "\nBenchmark: %.3f s simulated in %.3f s host (%.1fx real time)", sim_s, host_s, host_s > 0 ? sim_s / host_s : 0);
+  if (cpu_scale > 0) fprintf(out, ", planner charged at %gx host time", cpu_scale);
+  fputc('\n', out);
+  fprintf(out, "  Throughput: %llu blocks, %.0f blocks/s simulated, %.0f blocks/s host\n",
+    (unsigned long long)blocks, sim_s > 0 ? blocks / sim_s : 0, host_s > 0 ? blocks / host_s : 0);
+  fprintf(out, "  Planner: %llu ns/block mean, p50 %llu ns, p99 %llu ns, max %llu ns (%.0f blocks/s sustainable), %llu moves too short to queue\n",
+    (unsigned long long)plan_time.mean(), (unsigned long long)plan_time.percentile(0.5f), (unsigned long long)plan_time.percentile(0.99f),
+    (unsigned long long)plan_time.max, plan_time.total ? 1e9 * blocks / plan_time.total : 0, (unsigned long long)dropped_moves);
+  fprintf(out, "  Underruns: %llu, %.3f s waiting for blocks\n", (unsigned long long)underruns, starved_total / 1e9);
+  fprintf(out, "  Stepper ISR: %llu runs, %llu ns mean, p50 %llu ns, p99 %llu ns, max %llu ns\n",
+    (unsigned long long)isr_time.samples, (unsigned long long)isr_time.mean(), (unsigned long long)isr_time.percentile(0.5f),
+    (unsigned long long)isr_time.percentile(0.99f), (unsigned long long)isr_time.max);
+  isr_time.print(out, "    ");
+
+  // One line for scripts (buildroot/share/scripts/planner_bench.py)
+  fprintf(out, "BENCH blocks=%llu sim_s=%.6f host_s=%.6f plan_ns_mean=%llu plan_ns_p99=%llu underruns=%llu starved_s=%.6f isr_runs=%llu isr_ns_mean=%llu isr_ns_p99=%llu isr_ns_max=%llu\n",
+    (unsigned long long)blocks, sim_s, host_s, (unsigned long long)plan_time.mean(), (unsigned long long)plan_time.percentile(0.99f),
+    (unsigned long long)underruns, starved_total / 1e9, (unsigned long long)isr_time.samples, (unsigned long long)isr_time.mean(),
+    (unsigned long long)isr_time.percentile(0.99f), (unsigned long long)isr_time.max);
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,86 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "Clock.h"
+
+/**
+ * Planner and stepper benchmark (marlin --bench)
+ *
+ * Runs in virtual time, so the simulated ISRs only run while the firmware
+ * waits and the host time measured around the planner and the stepper ISR
+ * is theirs alone. Reports:
+ *  - host CPU time spent planning each block (populate + recalculate)
+ *  - host CPU time of each stepper ISR, as a histogram
+ *  - underruns: the planner ran dry and the stepper had to wait for a block
+ *  - blocks per simulated and per host second
+ *
+ * Virtual time stands still while the planner works, so by default it never
+ * falls behind. A cpu_scale charges its host time, multiplied by the scale,
+ * to the simulated clock, as on an MCU that many times slower than the host.
+ */
+class Benchmark {
+public:
+  // Log-scale histogram of nanoseconds, four buckets per power of two
+  struct Histogram {
+    static const uint16_t buckets = 160;
+    uint64_t count[buckets], samples, total, max;
+
+    void add(const uint64_t ns);
+    uint64_t percentile(const float p) const; // lower bound of the bucket holding it
+    uint64_t mean() const { return samples ? total / samples : 0; }
+    void print(FILE *out, const char * const indent) const;
+
+    static uint16_t bucket(const uint64_t ns);
+    static uint64_t lower_bound(const uint16_t b);
+  };
+
+  static void start(const float scale);
+  static void report(FILE *out);
+
+  static bool active() { return enabled; }
+
+  static uint64_t hostNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  // Called around the planner's work on one move, after any wait for a free block
+  static void planBegin() { if (enabled) plan_start = hostNanos(); }
+  static void planEnd(const bool queued);
+
+  // Planner::synchronize() empties the buffer on purpose. That isn't an underrun.
+  static void planSync() { draining = true; }
+
+  // Called after each stepper ISR with its host time and whether any block is left
+  static void stepperIsr(const uint64_t ns, const bool has_blocks);
+
+private:
+  static bool enabled, starved, had_blocks, draining;
+  static float cpu_scale;
+  static uint64_t plan_start, host_start, sim_start,
+                  starved_since, starved_total, underruns, dropped_moves;
+  static Histogram plan_time, isr_time;
+};
@@ -45,6 +45,7 @@ public:
 
   // Time Acceleration compensated
   static uint64_t nanos() {
+    if (virtual_time) return virtual_nanos;
     auto now = std::chrono::high_resolution_clock::now().time_since_epoch();
     return (now.count() - Clock::startup.count()) * Clock::time_multiplier;
   }
@@ -62,18 +63,22 @@ public:
   }
 
   static void delayCycles(uint64_t cycles) {
+    if (virtual_time) return wait((1000000000ULL / frequency) * cycles);
     std::this_thread::sleep_for(std::chrono::nanoseconds( (1000000000L / frequency) * cycles) / Clock::time_multiplier );
   }
 
   static void delayMicros(uint64_t micros) {
+    if (virtual_time) return wait(micros * 1000ULL);
     std::this_thread::sleep_for(std::chrono::microseconds( micros ) / Clock::time_multiplier);
   }
 
   static void delayMillis(uint64_t millis) {
+    if (virtual_time) return wait(millis * 1000000ULL);
     std::this_thread::sleep_for(std::chrono::milliseconds( millis ) / Clock::time_multiplier);
   }
 
   static void delaySeconds(double secs) {
+    if (virtual_time) return wait(uint64_t(secs * 1e9));
     std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(secs * 1000) / Clock::time_multiplier);
   }
 
@@ -82,7 +87,22 @@ public:
     Clock::time_multiplier = tm;
   }
 
+  /**
+   * Virtual time: the clock stands still until the firmware waits (delays,
+   * idle) and the simulated timer interrupts run synchronously at their exact
+   * deadlines, so runs are reproducible and never wait on the wall clock.
+   * Must be selected before the timers are initialized.
+   */
+  static void useVirtualTime(bool enable) { virtual_time = enable; }
+  static bool virtualTime() { return virtual_time; }
+
+  // Move virtual time forward, running any timer interrupts that come due
+  static void wait(uint64_t ns);
+  static void setVirtualNanos(uint64_t ns) { virtual_nanos = ns; }
+
 private:
+  static bool virtual_time;
+  static uint64_t virtual_nanos;
   static std::chrono::nanoseconds startup;
   static uint32_t frequency;
   static double time_multiplier;
@@ -0,0 +1,76 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+/**
+ * Auto-reset wakeup event backed by an eventfd.
+ *
+ * notify() is a single write() so it is async-signal-safe and may be used
+ * from the simulated ISRs as well as from the helper threads. wait() blocks
+ * until notified or until the timeout expires, and consumes the notification.
+ * Signals delivered to the waiting thread end the wait early.
+ */
+class Event {
+public:
+  Event() { fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC); }
+  ~Event() { if (fd >= 0) close(fd); }
+
+  Event(const Event&) = delete;
+  Event& operator=(const Event&) = delete;
+
+  void notify() {
+    const uint64_t one = 1;
+    if (write(fd, &one, sizeof(one))) { /* counter saturation is harmless */ }
+  }
+
+  // Wait for a notification. A negative timeout waits forever.
+  // Returns false if the timeout expired (or a signal arrived) first.
+  bool wait(const int64_t timeout_ns = -1) {
+    pollfd pfd = { fd, POLLIN, 0 };
+    timespec ts, *tsp = nullptr;
+    if (timeout_ns >= 0) {
+      ts.tv_sec  = timeout_ns / 1000000000LL;
+      ts.tv_nsec = timeout_ns % 1000000000LL;
+      tsp = &ts;
+    }
+    if (ppoll(&pfd, 1, tsp, nullptr) <= 0) return false;
+    clear();
+    return true;
+  }
+
+  // Drop any pending notification
+  void clear() {
+    uint64_t count;
+    if (read(fd, &count, sizeof(count))) { /* EAGAIN when nothing pending */ }
+  }
+
+  int handle() const { return fd; }
+
+private:
+  int fd;
+};
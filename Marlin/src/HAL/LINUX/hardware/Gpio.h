@@ -22,6 +22,7 @@
 #pragma once
 
 #include "Clock.h"
+#include "GpioTrace.h"
 #include "../../../inc/MarlinConfigPre.h"
 #include <stdint.h>
 
@@ -85,11 +86,7 @@ public:
     if (!valid_pin(pin)) return;
     GpioEvent::Type evt_type = value > 1 ? GpioEvent::SET_VALUE : value > pin_map[pin].value ? GpioEvent::RISE : value < pin_map[pin].value ? GpioEvent::FALL : GpioEvent::NOP;
     pin_map[pin].value = value;
-    GpioEvent evt(Clock::nanos(), pin, evt_type);
-    if (pin_map[pin].cb != nullptr) {
-      pin_map[pin].cb->interrupt(evt);
-    }
-    if (Gpio::logger != nullptr) Gpio::logger->log(evt);
+    notify(pin, evt_type, value);
   }
 
   static uint16_t get(pin_type pin) {
@@ -104,9 +101,7 @@ public:
   static void setMode(pin_type pin, uint8_t value) {
     if (!valid_pin(pin)) return;
     pin_map[pin].mode = value;
-    GpioEvent evt(Clock::nanos(), pin, GpioEvent::Type::SETM);
-    if (pin_map[pin].cb != nullptr) pin_map[pin].cb->interrupt(evt);
-    if (Gpio::logger != nullptr) Gpio::logger->log(evt);
+    notify(pin, GpioEvent::Type::SETM, value);
   }
 
   static uint8_t getMode(pin_type pin) {
@@ -117,9 +112,7 @@ public:
   static void setDir(pin_type pin, uint8_t value) {
     if (!valid_pin(pin)) return;
     pin_map[pin].dir = value;
-    GpioEvent evt(Clock::nanos(), pin, GpioEvent::Type::SETD);
-    if (pin_map[pin].cb != nullptr) pin_map[pin].cb->interrupt(evt);
-    if (Gpio::logger != nullptr) Gpio::logger->log(evt);
+    notify(pin, GpioEvent::Type::SETD, value);
   }
 
   static uint8_t getDir(pin_type pin) {
@@ -137,5 +130,16 @@ public:
   }
 
 private:
+  // Only timestamp and dispatch the event if something is listening
+  static void notify(pin_type pin, GpioEvent::Type type, uint16_t value) {
+    Peripheral * const cb = pin_map[pin].cb;
+    const bool trace = GpioTrace::active();
+    if (cb == nullptr && Gpio::logger == nullptr && !trace) return;
+    const GpioEvent evt(Clock::nanos(), pin, type);
+    if (trace) GpioTrace::log(evt.timestamp, pin, type, value);
+    if (cb != nullptr) cb->interrupt(evt);
+    if (Gpio::logger != nullptr) Gpio::logger->log(evt);
+  }
+
   static IOLogger* logger;
 };
@@ -0,0 +1,116 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include <signal.h>
+
+#include "../../../inc/MarlinConfig.h"
+#include "GpioTrace.h"
+
+GpioTrace::Ring GpioTrace::rings[GpioTrace::max_rings];
+std::atomic<uint8_t> GpioTrace::ring_count{0};
+thread_local GpioTrace::Ring *GpioTrace::thread_ring = nullptr;
+
+std::atomic<bool> GpioTrace::running{false};
+Event GpioTrace::wake;
+FILE *GpioTrace::file = nullptr;
+std::thread GpioTrace::writer;
+
+void GpioTrace::Ring::init() {
+  for (uint32_t i = 0; i < size; i++) slots[i].seq.store(i, std::memory_order_relaxed);
+  head = tail = dropped = 0;
+  last_timestamp = 0;
+}
+
+// Single consumer: only the writer thread pops
+bool GpioTrace::Ring::pop(GpioTraceRecord &record) {
+  const uint32_t pos = tail.load(std::memory_order_relaxed);
+  Slot &slot = slots[pos & mask];
+  if (slot.seq.load(std::memory_order_acquire) != pos + 1) return false;
+  record = slot.record;
+  last_timestamp = record.timestamp;
+  slot.seq.store(pos + size, std::memory_order_release);
+  tail.store(pos + 1, std::memory_order_relaxed);
+  return true;
+}
+
+// Threads beyond max_rings share the last ring, which is safe, just slower
+GpioTrace::Ring* GpioTrace::claim_ring() {
+  uint8_t n = ring_count.load();
+  while (n < max_rings && !ring_count.compare_exchange_weak(n, n + 1)) { /* retry */ }
+  return &rings[n < max_rings ? n : max_rings - 1];
+}
+
+bool GpioTrace::start(const char *filename) {
+  if (active()) return false;
+  file = fopen(filename, "wb");
+  if (!file) return false;
+
+  GpioTraceHeader header = { { 'M', 'R', 'L', 'N', 'G', 'P', 'I', 'O' }, version, sizeof(GpioTraceRecord) };
+  fwrite(&header, sizeof(header), 1, file);
+
+  for (Ring &ring : rings) ring.init();
+  running = true;
+  writer = std::thread(writer_thread);
+  return true;
+}
+
+void GpioTrace::stop() {
+  if (!active()) return;
+  running = false;
+  wake.notify();
+  writer.join();
+  drain();
+  fclose(file);
+  file = nullptr;
+}
+
+void GpioTrace::drain() {
+  GpioTraceRecord batch[1024];
+  const uint8_t count = _MIN(ring_count.load(), max_rings);
+  for (uint8_t r = 0; r < count; r++) {
+    Ring &ring = rings[r];
+    size_t n = 0;
+    while (ring.pop(batch[n]))
+      if (++n == COUNT(batch)) { fwrite(batch, sizeof(batch[0]), n, file); n = 0; }
+    if (const uint32_t lost = ring.dropped.exchange(0)) {
+      if (n == COUNT(batch)) { fwrite(batch, sizeof(batch[0]), n, file); n = 0; }
+      batch[n++] = { ring.last_timestamp, -1, EVENT_OVERFLOW, 0, lost };
+    }
+    if (n) fwrite(batch, sizeof(batch[0]), n, file);
+  }
+  fflush(file);
+}
+
+void GpioTrace::writer_thread() {
+  sigset_t mask;
+  sigemptyset(&mask);
+  sigaddset(&mask, SIGRTMIN);
+  pthread_sigmask(SIG_BLOCK, &mask, nullptr);
+
+  while (running) {
+    wake.wait(10000000);
+    drain();
+  }
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,153 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+#include <stdio.h>
+#include <thread>
+
+#include "Clock.h"
+#include "Event.h"
+
+/**
+ * Binary GPIO event trace
+ *
+ * The file is a GpioTraceHeader followed by fixed-size little-endian
+ * GpioTraceRecords, so it can be mmapped as a flat array. Records from
+ * different threads are written in batches and are not globally sorted.
+ * Use buildroot/share/scripts/gpio_trace.py to convert to CSV or VCD.
+ */
+struct GpioTraceHeader {
+  char     magic[8];    // "MRLNGPIO"
+  uint32_t version;     // GpioTrace::version
+  uint32_t record_size; // sizeof(GpioTraceRecord)
+};
+
+struct GpioTraceRecord {
+  uint64_t timestamp;   // ns, Clock::nanos()
+  int16_t  pin;         // or the field of a marker
+  uint8_t  event;       // GpioEvent::Type or one of the GpioTrace markers
+  uint8_t  reserved;
+  uint32_t value;       // pin value, mode or direction after the event, or marker data
+};
+
+static_assert(sizeof(GpioTraceRecord) == 16, "GpioTraceRecord must be 16 bytes");
+
+class GpioTrace {
+public:
+  static const uint32_t version = 2;
+
+  // Markers, recorded alongside the pin events
+  static const uint8_t EVENT_BLOCK       = 0xFD, // Stepper started a block, one record per BlockField
+                       EVENT_ISR_OVERRUN = 0xFE, // Stepper::isr() ran out of loops
+                       EVENT_OVERFLOW    = 0xFF; // 'value' events were lost before this record
+
+  enum BlockField : int16_t {
+    BLOCK_STEP_EVENTS, BLOCK_INITIAL_RATE, BLOCK_NOMINAL_RATE, BLOCK_FINAL_RATE,
+    BLOCK_ACCELERATE_UNTIL, BLOCK_DECELERATE_AFTER, BLOCK_ACCELERATION,
+    BLOCK_STEPS_A, BLOCK_STEPS_B, BLOCK_STEPS_C, BLOCK_STEPS_E, BLOCK_DIRECTION_BITS
+  };
+
+  static bool start(const char *filename);
+  static void stop();
+
+  static bool active() { return running.load(std::memory_order_relaxed); }
+
+  // Lock-free and async-signal-safe, so it may be called from the simulated ISRs
+  static void log(const uint64_t timestamp, const int16_t pin, const uint8_t event, const uint32_t value) {
+    if (!thread_ring) thread_ring = claim_ring();
+    if (!thread_ring->push({ timestamp, pin, event, 0, value }))
+      thread_ring->dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  static void marker(const uint8_t event, const int16_t field, const uint32_t value) {
+    if (active()) log(Clock::nanos(), field, event, value);
+  }
+
+  // Record the planned trapezoid of a block_t as it starts to execute
+  template<typename BLOCK>
+  static void block(const BLOCK *b) {
+    if (!active()) return;
+    const uint64_t now = Clock::nanos();
+    const uint32_t fields[] = {
+      b->step_event_count, b->initial_rate, b->nominal_rate, b->final_rate,
+      b->accelerate_until, b->decelerate_after, b->acceleration_steps_per_s2,
+      b->steps.a, b->steps.b, b->steps.c, b->steps.e, b->direction_bits
+    };
+    for (int16_t i = 0; i < int16_t(sizeof(fields) / sizeof(*fields)); i++) log(now, i, EVENT_BLOCK, fields[i]);
+  }
+
+private:
+  /**
+   * Bounded ring, one per producing thread. Slots carry a sequence number
+   * so a push interrupted by a signal handler that also pushes stays valid.
+   */
+  struct Ring {
+    static const uint32_t size = 1UL << 16, mask = size - 1;
+
+    struct Slot {
+      std::atomic<uint32_t> seq;
+      GpioTraceRecord record;
+    } slots[size];
+
+    std::atomic<uint32_t> head, tail, dropped;
+    uint64_t last_timestamp; // of the last record popped
+
+    void init();
+    bool pop(GpioTraceRecord &record);
+
+    bool push(const GpioTraceRecord &record) {
+      uint32_t pos = head.load(std::memory_order_relaxed);
+      for (;;) {
+        Slot &slot = slots[pos & mask];
+        const int32_t diff = int32_t(slot.seq.load(std::memory_order_acquire) - pos);
+        if (diff == 0) {
+          if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        }
+        else if (diff < 0)
+          return false; // full
+        else
+          pos = head.load(std::memory_order_relaxed);
+      }
+      Slot &slot = slots[pos & mask];
+      slot.record = record;
+      slot.seq.store(pos + 1, std::memory_order_release);
+      if (pos - tail.load(std::memory_order_relaxed) == size / 2) wake.notify();
+      return true;
+    }
+  };
+
+  static const uint8_t max_rings = 4;
+  static Ring rings[max_rings];
+  static std::atomic<uint8_t> ring_count;
+  static thread_local Ring *thread_ring;
+
+  static std::atomic<bool> running;
+  static Event wake;
+  static FILE *file;
+  static std::thread writer;
+
+  static Ring* claim_ring();
+  static void drain();
+  static void writer_thread();
+};
@@ -34,12 +34,17 @@ Timer::Timer() {
   period = 0;
   start_time = 0;
   avg_error = 0;
+  deadline = UINT64_MAX;
 }
 
 Timer::~Timer() {
-  timer_delete(timerid);
+  if (!Clock::virtualTime()) timer_delete(timerid);
 }
 
+Timer* Timer::instances[Timer::max_timers];
+uint8_t Timer::instance_count = 0;
+bool Timer::in_isr = false;
+
 void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
   struct sigaction sa;
   struct sigevent sev;
@@ -47,6 +52,12 @@ void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
   frequency = sim_freq;
   cbfn = fn;
 
+  if (Clock::virtualTime()) {
+    if (instance_count < max_timers) instances[instance_count++] = this;
+    start_time = Clock::nanos();
+    return;
+  }
+
   sa.sa_flags = SA_SIGINFO;
   sa.sa_sigaction = Timer::handler;
   sigemptyset(&sa.sa_mask);
@@ -73,6 +84,7 @@ void Timer::start(uint32_t frequency) {
 }
 
 void Timer::enable() {
+  if (Clock::virtualTime()) { active = true; return; }
   if (sigprocmask(SIG_UNBLOCK, &mask, nullptr) == -1) {
     return; // todo: handle error
   }
@@ -81,6 +93,7 @@ void Timer::enable() {
 }
 
 void Timer::disable() {
+  if (Clock::virtualTime()) { active = false; return; }
   if (sigprocmask(SIG_SETMASK, &mask, nullptr) == -1) {
     return; // todo: handle error
   }
@@ -88,6 +101,12 @@ void Timer::disable() {
 }
 
 void Timer::setCompare(uint32_t compare) {
+  if (Clock::virtualTime()) {
+    // Like a match register: fire when the count since the last ISR reaches compare
+    this->compare = compare;
+    deadline = start_time + Clock::ticksToNanos(compare, frequency);
+    return;
+  }
   uint32_t nsec_offset = 0;
   if (active) {
     nsec_offset = Clock::nanos() - this->start_time; // calculate how long the timer would have been running for
@@ -111,7 +130,44 @@ void Timer::setCompare(uint32_t compare) {
 }
 
 uint32_t Timer::getCount() {
+  // Reading the counter takes time, otherwise busy-waits on it would never end
+  if (Clock::virtualTime()) Clock::wait(Clock::ticksToNanos(1, frequency));
   return Clock::nanosToTicks(Clock::nanos() - this->start_time, frequency);
 }
 
+void Timer::fire() {
+  start_time = Clock::nanos();
+  deadline = start_time + Clock::ticksToNanos(compare, frequency);
+  in_isr = true;
+  cbfn();
+  in_isr = false;
+}
+
+/**
+ * Advance virtual time to 'until', running each enabled timer ISR at its
+ * deadline in time order (ties go to the lower timer). A deadline that passes
+ * while the timer is disabled stays pending until it is enabled again.
+ * Time spent inside an ISR only moves the clock; other ISRs wait for it to end.
+ */
+void Timer::runUntil(uint64_t until) {
+  if (!in_isr) for (;;) {
+    Timer *next = nullptr;
+    for (uint8_t i = 0; i < instance_count; i++) {
+      Timer * const t = instances[i];
+      if (t->active && t->deadline <= until && (!next || t->deadline < next->deadline)) next = t;
+    }
+    if (!next) break;
+    if (next->deadline > Clock::nanos()) Clock::setVirtualNanos(next->deadline);
+    next->fire();
+  }
+  if (until > Clock::nanos()) Clock::setVirtualNanos(until);
+}
+
+uint64_t Timer::nextDeadline() {
+  uint64_t next = UINT64_MAX;
+  for (uint8_t i = 0; i < instance_count; i++)
+    if (instances[i]->active && instances[i]->deadline < next) next = instances[i]->deadline;
+  return next;
+}
+
 #endif // __PLAT_LINUX__
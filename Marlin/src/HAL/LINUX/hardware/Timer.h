@@ -48,6 +48,10 @@ public:
   uint32_t getOverruns() {return overruns;}
   uint32_t getAvgError() {return avg_error;}
 
+  // Virtual time scheduling (see Clock::useVirtualTime)
+  static void runUntil(uint64_t until);
+  static uint64_t nextDeadline();
+
   intptr_t getID() {
     return (*(intptr_t*)timerid);
   }
@@ -63,6 +67,14 @@ public:
   }
 
 private:
+  void fire();
+
+  static const uint8_t max_timers = 4;
+  static Timer* instances[max_timers];
+  static uint8_t instance_count;
+  static bool in_isr;
+  uint64_t deadline;
+
   bool active;
   uint32_t compare;
   uint32_t frequency;
@@ -29,6 +29,8 @@
 #include <stdarg.h>
 #include <stdio.h>
 
+#include "../hardware/Event.h"
+
 /**
  * Generic RingBuffer
  * T type of the buffer array
@@ -92,12 +94,20 @@ public:
     return receive_buffer.peek(&value) ? value : -1;
   }
 
-  int read() { return receive_buffer.read(); }
+  int read() {
+    const bool was_full = receive_buffer.full();
+    const int c = receive_buffer.read();
+    if (was_full) rx_space.notify();
+    return c;
+  }
 
   size_t write(char c) {
     if (!host_connected) return 0;
-    while (!transmit_buffer.free());
-    return transmit_buffer.write(c);
+    while (transmit_buffer.full()) tx_space.wait(1000000);
+    const bool was_empty = transmit_buffer.empty();
+    const size_t n = transmit_buffer.write(c);
+    if (was_empty) tx_ready.notify();
+    return n;
   }
 
   operator bool() { return host_connected; }
@@ -114,7 +124,7 @@ public:
 
   void flushTX() {
     if (host_connected)
-      while (transmit_buffer.available()) { /* nada */ }
+      while (transmit_buffer.available()) tx_space.wait(1000000);
   }
 
   void printf(const char *format, ...) {
@@ -123,15 +133,8 @@ public:
     va_start(vArgs, format);
     int length = vsnprintf((char *) buffer, 256, (char const *) format, vArgs);
     va_end(vArgs);
-    if (length > 0 && length < 256) {
-      if (host_connected) {
-        for (int i = 0; i < length;) {
-          if (transmit_buffer.write(buffer[i])) {
-            ++i;
-          }
-        }
-      }
-    }
+    if (length > 0 && length < 256)
+      for (int i = 0; i < length; i++) write(buffer[i]);
   }
 
   #define DEC 10
@@ -205,4 +208,7 @@ public:
   volatile RingBuffer<uint8_t, 128> receive_buffer;
   volatile RingBuffer<uint8_t, 128> transmit_buffer;
   volatile bool host_connected;
+
+  // Wakeups between Marlin and the stdin / stdout threads
+  Event rx_ready, rx_space, tx_ready, tx_space;
 };
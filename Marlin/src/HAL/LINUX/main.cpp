@@ -34,76 +34,201 @@ extern void loop();
 #include "hardware/IOLoggerCSV.h"
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
+#include "hardware/Event.h"
+#include "hardware/Timer.h"
+#include "hardware/GpioTrace.h"
+#include "hardware/Benchmark.h"
+
+#include "../../gcode/queue.h"
+#include "../../sd/cardreader.h"
+#include "../../module/planner.h"
+
+#include <atomic>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+
+static std::atomic<bool> input_closed{false}, simulation_done{false};
+
+// Keep the simulated ISRs (SIGRTMIN) on the Marlin thread
+static void block_timer_signals() {
+  sigset_t mask;
+  sigemptyset(&mask);
+  sigaddset(&mask, SIGRTMIN);
+  pthread_sigmask(SIG_BLOCK, &mask, nullptr);
+}
 
 // simple stdout / stdin implementation for fake serial port
 void write_serial_thread() {
-  for (;;) {
-    for (std::size_t i = usb_serial.transmit_buffer.available(); i > 0; i--) {
-      fputc(usb_serial.transmit_buffer.read(), stdout);
+  block_timer_signals();
+  char buffer[128];
+  while (!simulation_done || usb_serial.transmit_buffer.available()) {
+    usb_serial.tx_ready.wait();
+    while (std::size_t len = usb_serial.transmit_buffer.available()) {
+      for (std::size_t i = 0; i < len; i++)
+        buffer[i] = usb_serial.transmit_buffer.read();
+      usb_serial.tx_space.notify();
+      fwrite(buffer, 1, len, stdout);
     }
-    std::this_thread::yield();
+    fflush(stdout);
   }
 }
 
 void read_serial_thread() {
-  char buffer[255] = {};
+  block_timer_signals();
+  uint8_t buffer[128];
   for (;;) {
-    std::size_t len = _MIN(usb_serial.receive_buffer.free(), 254U);
-    if (fgets(buffer, len, stdin))
-      for (std::size_t i = 0; i < strlen(buffer); i++)
-        usb_serial.receive_buffer.write(buffer[i]);
-    std::this_thread::yield();
+    std::size_t len = usb_serial.receive_buffer.free();
+    if (!len) { usb_serial.rx_space.wait(10000000); continue; }
+    const ssize_t count = ::read(STDIN_FILENO, buffer, _MIN(len, sizeof(buffer)));
+    if (count < 0 && errno == EINTR) continue;
+    if (count <= 0) break; // EOF
+    for (ssize_t i = 0; i < count; i++)
+      usb_serial.receive_buffer.write(buffer[i]);
+    usb_serial.rx_ready.notify();
   }
+  input_closed = true;
+  usb_serial.rx_ready.notify();
 }
 
-void simulation_loop() {
-  Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
-  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
-  LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
-  LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
-  LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
-  LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
+/**
+ * Peripherals attached to pins react synchronously in Gpio::set, so only the
+ * time-based models (heaters) need periodic updates. In real time they run on
+ * the simulation thread, in virtual time on a simulated timer at the same rate.
+ */
+#define SIMULATION_UPDATE_HZ 100 // plenty for the thermal model
 
-  //#define GPIO_LOGGING // Full GPIO and Positional Logging
+//#define GPIO_LOGGING // Full GPIO and Positional Logging to CSV (slow, prefer --gpio-trace)
+
+void simulation_update() {
+  static Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
+  static Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
+  static LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
+  static LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
+  static LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
+  static LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
 
   #ifdef GPIO_LOGGING
-    IOLoggerCSV logger("all_gpio_log.csv");
-    Gpio::attachLogger(&logger);
+    static IOLoggerCSV logger("all_gpio_log.csv");
+    static std::ofstream position_log;
+    static int32_t x, y, z;
+    if (!position_log.is_open()) {
+      Gpio::attachLogger(&logger);
+      position_log.open("axis_position_log.csv");
+    }
+  #endif
+
+  hotend.update();
+  bed.update();
 
-    std::ofstream position_log;
-    position_log.open("axis_position_log.csv");
+  x_axis.update();
+  y_axis.update();
+  z_axis.update();
+  extruder0.update();
 
-    int32_t x,y,z;
+  #ifdef GPIO_LOGGING
+    if (x_axis.position != x || y_axis.position != y || z_axis.position != z) {
+      uint64_t update = MAX3(x_axis.last_update, y_axis.last_update, z_axis.last_update);
+      position_log << update << ", " << x_axis.position << ", " << y_axis.position << ", " << z_axis.position << std::endl;
+      position_log.flush();
+      x = x_axis.position;
+      y = y_axis.position;
+      z = z_axis.position;
+    }
+    // flush the logger
+    logger.flush();
   #endif
+}
 
+Event simulation_wake; // Notify to run the simulation update early
+
+void simulation_loop() {
+  block_timer_signals();
   for (;;) {
+    simulation_update();
+    simulation_wake.wait(1000000000ULL / (SIMULATION_UPDATE_HZ));
+  }
+}
 
-    hotend.update();
-    bed.update();
-
-    x_axis.update();
-    y_axis.update();
-    z_axis.update();
-    extruder0.update();
-
-    #ifdef GPIO_LOGGING
-      if (x_axis.position != x || y_axis.position != y || z_axis.position != z) {
-        uint64_t update = MAX3(x_axis.last_update, y_axis.last_update, z_axis.last_update);
-        position_log << update << ", " << x_axis.position << ", " << y_axis.position << ", " << z_axis.position << std::endl;
-        position_log.flush();
-        x = x_axis.position;
-        y = y_axis.position;
-        z = z_axis.position;
-      }
-      // flush the logger
-      logger.flush();
-    #endif
+/**
+ * Called from idle(). Sleep the Marlin thread while there is nothing to do
+ * instead of spinning. Stepper and temperature ISRs are signals, so they still
+ * run (and end the sleep) on time. New serial input also ends the sleep.
+ *
+ * The first idle() of each loop() sleeps only when no commands are waiting,
+ * while idle() called from inside a command (waiting for the planner, a heater
+ * or a dwell) always naps briefly since the command can't proceed anyway.
+ */
+static bool loop_top;
+
+/**
+ * In virtual time the clock only advances while the firmware is waiting on
+ * itself, so results depend only on the G-code, not on when it arrives:
+ *  - Inside a command, jump straight to the next timer interrupt.
+ *  - With nothing to do, block (without advancing) until more input arrives.
+ *  - Once stdin is closed, let queued motion finish, then end the simulation.
+ */
+void HAL_idletask() {
+  const bool top = loop_top;
+  loop_top = false;
+
+  if (usb_serial.available()) return;
+  if (top && (queue.has_commands_queued() || IS_SD_PRINTING())) return;
+
+  if (!Clock::virtualTime()) {
+    usb_serial.rx_ready.wait(top ? 10000000 : 1000000);
+    return;
+  }
+
+  if (top && !input_closed) {
+    usb_serial.rx_ready.wait(10000000);
+    return;
+  }
 
-    std::this_thread::yield();
+  if (top && !planner.has_blocks_queued()) {
+    simulation_done = true;
+    return;
   }
+
+  const uint64_t now = Clock::nanos(), next = Timer::nextDeadline();
+  Clock::wait(next > now ? _MIN(next - now, uint64_t(1000000)) : 0);
 }
 
-int main() {
+/**
+ * Options:
+ *  --virtual-time      Run on a deterministic simulated clock, as fast as possible.
+ *                      Exits once stdin is closed and all motion is complete.
+ *  --gpio-trace <file> Record every GPIO event to a binary trace file.
+ *                      Convert with buildroot/share/scripts/gpio_trace.py
+ *  --bench             Time the planner and the stepper ISR and print a report
+ *                      to stderr at the end. Implies --virtual-time.
+ *                      Run a set of G-code files with buildroot/share/scripts/planner_bench.py
+ *  --bench-scale <x>   Charge the planner's host time, times <x>, to the simulated
+ *                      clock, as on a board <x> times slower than this host.
+ *  --check-planner     With PLANNER_FIXED_POINT, compare the integer trapezoids with
+ *                      the float ones and exit with status 1 on a mismatch.
+ */
+int main(int argc, char *argv[]) {
+  const char *trace_file = nullptr;
+  bool bench = false;
+  float bench_scale = 0;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--virtual-time")) Clock::useVirtualTime(true);
+    else if (!strcmp(argv[i], "--gpio-trace") && i + 1 < argc) trace_file = argv[++i];
+    else if (!strcmp(argv[i], "--bench")) bench = true;
+    else if (!strcmp(argv[i], "--bench-scale") && i + 1 < argc) { bench = true; bench_scale = atof(argv[++i]); }
+    #if ENABLED(PLANNER_FIXED_POINT)
+      else if (!strcmp(argv[i], "--check-planner")) return Planner::check_trapezoids() ? 0 : 1;
+    #endif
+    else { fprintf(stderr, "Unknown option: %s\n", argv[i]); return 1; }
+  }
+  if (bench) Clock::useVirtualTime(true);
+
+  if (trace_file && !GpioTrace::start(trace_file)) {
+    fprintf(stderr, "Can't open %s\n", trace_file);
+    return 1;
+  }
+
   std::thread write_serial (write_serial_thread);
   std::thread read_serial (read_serial_thread);
 
@@ -118,19 +243,33 @@ int main() {
 
   HAL_timer_init();
 
-  std::thread simulation (simulation_loop);
+  std::thread simulation;
+  Timer simulation_timer;
+  if (Clock::virtualTime()) {
+    simulation_update();
+    simulation_timer.init(2, 1000000, simulation_update);
+    simulation_timer.start(SIMULATION_UPDATE_HZ);
+    simulation_timer.enable();
+  }
+  else
+    simulation = std::thread(simulation_loop);
 
   DELAY_US(10000);
 
   setup();
-  for (;;) {
+  if (bench) Benchmark::start(bench_scale);
+  while (!simulation_done) {
+    loop_top = true;
     loop();
-    std::this_thread::yield();
   }
 
-  simulation.join();
+  // Only reached in virtual time
+  GpioTrace::stop();
+  Benchmark::report(stderr);
+  usb_serial.tx_ready.notify();
   write_serial.join();
   read_serial.join();
+  return 0;
 }
 
 #endif // __PLAT_LINUX__
@@ -24,6 +24,7 @@
 #include "hardware/Timer.h"
 
 #include "../../inc/MarlinConfig.h"
+#include "../../module/planner.h"
 
 /**
  * Use POSIX signals to attempt to emulate Interrupts
@@ -35,8 +36,16 @@ HAL_TEMP_TIMER_ISR();
 
 Timer timers[2];
 
+// With --bench, time each stepper ISR and watch for the planner running dry
+static void stepper_timer_isr() {
+  if (!Benchmark::active()) return TIMER0_IRQHandler();
+  const uint64_t start = Benchmark::hostNanos();
+  TIMER0_IRQHandler();
+  Benchmark::stepperIsr(Benchmark::hostNanos() - start, planner.has_blocks_queued());
+}
+
 void HAL_timer_init() {
-  timers[0].init(0, STEPPER_TIMER_RATE, TIMER0_IRQHandler);
+  timers[0].init(0, STEPPER_TIMER_RATE, stepper_timer_isr);
   timers[1].init(1, TEMP_TIMER_RATE, TIMER1_IRQHandler);
 }
 
@@ -113,6 +113,10 @@
   #include "feature/leds/leds.h"
 #endif
 
+#if ENABLED(NEOPIXEL_EFFECTS)
+  #include "feature/leds/neopixel_fx.h"
+#endif
+
 #if ENABLED(BLTOUCH)
   #include "feature/bltouch.h"
 #endif
@@ -487,7 +491,7 @@ void startOrResumeJob() {
  */
 inline void manage_inactivity(const bool ignore_stepper_queue=false) {
 
-  if (queue.length < BUFSIZE) queue.get_available_commands();
+  if (queue.has_space()) queue.get_available_commands();
 
   const millis_t ms = millis();
 
@@ -729,6 +733,9 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
   // Handle SD Card insert / remove
   TERN_(SDSUPPORT, card.manage_media());
 
+  // Read ahead of the SD print while there's time
+  TERN_(SD_BLOCK_CACHE, card.prefetch());
+
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, Sd2Card::idle());
 
@@ -741,6 +748,13 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
   // Update the Beeper queue
   TERN_(USE_BEEPER, buzzer.tick());
 
+  // Run NeoPixel effects and refresh strips with staged changes
+  #if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+    TERN_(NEOPIXEL_EFFECTS, neofx.idle_task());
+    neo.idle_task();
+    TERN_(NEOPIXEL2_SEPARATE, neo2.idle_task());
+  #endif
+
   // Handle UI input / draw events
   TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update());
 
@@ -147,20 +147,20 @@ void print_bilinear_leveling_grid() {
   #define ABL_GRID_POINTS_VIRT_Y (GRID_MAX_POINTS_Y - 1) * (BILINEAR_SUBDIVISIONS) + 1
   #define ABL_TEMP_POINTS_X (GRID_MAX_POINTS_X + 2)
   #define ABL_TEMP_POINTS_Y (GRID_MAX_POINTS_Y + 2)
-  float z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+  #if DISABLED(ABL_BILINEAR_CELL_CACHE)
+    float z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+  #endif
   xy_pos_t bilinear_grid_spacing_virt;
   xy_float_t bilinear_grid_factor_virt;
 
-  void print_bilinear_leveling_grid_virt() {
-    SERIAL_ECHOLNPGM("Subdivided with CATMULL ROM Leveling Grid:");
-    print_2d_array(ABL_GRID_POINTS_VIRT_X, ABL_GRID_POINTS_VIRT_Y, 5,
-      [](const uint8_t ix, const uint8_t iy) { return z_values_virt[ix][iy]; }
-    );
-  }
-
   #define LINEAR_EXTRAPOLATION(E, I) ((E) * 2 - (I))
   float bed_level_virt_coord(const uint8_t x, const uint8_t y) {
     uint8_t ep = 0, ip = 1;
+    if (x > (GRID_MAX_POINTS_X) + 1 || y > (GRID_MAX_POINTS_Y) + 1) {
+      // Two points beyond the mesh are only asked for at its edges, where
+      // bed_level_virt_cmr gives them no weight. Don't read past z_values.
+      return 0.0;
+    }
     if (!x || x == ABL_TEMP_POINTS_X - 1) {
       if (x) {
         ep = GRID_MAX_POINTS_X - 1;
@@ -216,32 +216,28 @@ void print_bilinear_leveling_grid() {
     return bed_level_virt_cmr(row, 1, tx);
   }
 
+  // Get a point of the subdivided grid
+  static float bed_level_virt_point(const uint8_t vx, const uint8_t vy) {
+    return bed_level_virt_2cmr(
+      vx / (BILINEAR_SUBDIVISIONS) + 1,
+      vy / (BILINEAR_SUBDIVISIONS) + 1,
+      (float)(vx % (BILINEAR_SUBDIVISIONS)) / (BILINEAR_SUBDIVISIONS),
+      (float)(vy % (BILINEAR_SUBDIVISIONS)) / (BILINEAR_SUBDIVISIONS)
+    );
+  }
+
+  // With ABL_BILINEAR_CELL_CACHE the cells are made straight from the points
   void bed_level_virt_interpolate() {
     bilinear_grid_spacing_virt = bilinear_grid_spacing / (BILINEAR_SUBDIVISIONS);
     bilinear_grid_factor_virt = bilinear_grid_spacing_virt.reciprocal();
-    LOOP_L_N(y, GRID_MAX_POINTS_Y)
-      LOOP_L_N(x, GRID_MAX_POINTS_X)
-        LOOP_L_N(ty, BILINEAR_SUBDIVISIONS)
-          LOOP_L_N(tx, BILINEAR_SUBDIVISIONS) {
-            if ((ty && y == (GRID_MAX_POINTS_Y) - 1) || (tx && x == (GRID_MAX_POINTS_X) - 1))
-              continue;
-            z_values_virt[x * (BILINEAR_SUBDIVISIONS) + tx][y * (BILINEAR_SUBDIVISIONS) + ty] =
-              bed_level_virt_2cmr(
-                x + 1,
-                y + 1,
-                (float)tx / (BILINEAR_SUBDIVISIONS),
-                (float)ty / (BILINEAR_SUBDIVISIONS)
-              );
-          }
+    #if DISABLED(ABL_BILINEAR_CELL_CACHE)
+      LOOP_L_N(x, ABL_GRID_POINTS_VIRT_X)
+        LOOP_L_N(y, ABL_GRID_POINTS_VIRT_Y)
+          z_values_virt[x][y] = bed_level_virt_point(x, y);
+    #endif
   }
 #endif // ABL_BILINEAR_SUBDIVISION
 
-// Refresh after other values have been updated
-void refresh_bed_level() {
-  bilinear_grid_factor = bilinear_grid_spacing.reciprocal();
-  TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
-}
-
 #if ENABLED(ABL_BILINEAR_SUBDIVISION)
   #define ABL_BG_SPACING(A) bilinear_grid_spacing_virt.A
   #define ABL_BG_FACTOR(A)  bilinear_grid_factor_virt.A
@@ -256,9 +252,89 @@ void refresh_bed_level() {
   #define ABL_BG_GRID(X,Y)  z_values[X][Y]
 #endif
 
+#if ENABLED(ABL_BILINEAR_CELL_CACHE)
+
+  // Each cell as z = a + b * x + c * y + d * x * y, with x and y going from 0 to 1 across it
+  typedef struct { float a, b, c, d; } bilinear_cell_t;
+  static bilinear_cell_t bilinear_cells[ABL_BG_POINTS_X - 1][ABL_BG_POINTS_Y - 1];
+
+  static inline void bilinear_cell_set(const uint8_t x, const uint8_t y, const float &z00, const float &z10, const float &z01, const float &z11) {
+    bilinear_cells[x][y] = { z00, z10 - z00, z01 - z00, z11 - z10 - z01 + z00 };
+  }
+
+  // Update the cells after the grid has changed
+  void bilinear_cells_update() {
+    #if ENABLED(ABL_BILINEAR_SUBDIVISION)
+      // Work out the subdivided grid a column at a time instead of keeping all of it
+      float column[2][ABL_BG_POINTS_Y];
+      LOOP_L_N(y, ABL_BG_POINTS_Y) column[0][y] = bed_level_virt_point(0, y);
+      LOOP_L_N(x, ABL_BG_POINTS_X - 1) {
+        const float (&z0)[ABL_BG_POINTS_Y] = column[x & 1];
+        float (&z1)[ABL_BG_POINTS_Y] = column[!(x & 1)];
+        LOOP_L_N(y, ABL_BG_POINTS_Y) z1[y] = bed_level_virt_point(x + 1, y);
+        LOOP_L_N(y, ABL_BG_POINTS_Y - 1) bilinear_cell_set(x, y, z0[y], z1[y], z0[y + 1], z1[y + 1]);
+      }
+    #else
+      LOOP_L_N(x, ABL_BG_POINTS_X - 1)
+        LOOP_L_N(y, ABL_BG_POINTS_Y - 1)
+          bilinear_cell_set(x, y, z_values[x][y], z_values[x + 1][y], z_values[x][y + 1], z_values[x + 1][y + 1]);
+    #endif
+  }
+
+#endif
+
+#if ENABLED(ABL_BILINEAR_SUBDIVISION)
+
+  void print_bilinear_leveling_grid_virt() {
+    SERIAL_ECHOLNPGM("Subdivided with CATMULL ROM Leveling Grid:");
+    print_2d_array(ABL_GRID_POINTS_VIRT_X, ABL_GRID_POINTS_VIRT_Y, 5,
+      [](const uint8_t ix, const uint8_t iy) {
+        #if ENABLED(ABL_BILINEAR_CELL_CACHE)
+          // Get the point back from a cell it's a corner of
+          const uint8_t cx = _MIN(ix, ABL_BG_POINTS_X - 2), cy = _MIN(iy, ABL_BG_POINTS_Y - 2);
+          const bilinear_cell_t &cell = bilinear_cells[cx][cy];
+          const bool fx = ix > cx, fy = iy > cy;
+          return cell.a + (fx ? cell.b : 0) + (fy ? cell.c : 0) + (fx && fy ? cell.d : 0);
+        #else
+          return z_values_virt[ix][iy];
+        #endif
+      }
+    );
+  }
+
+#endif
+
+// Refresh after other values have been updated
+void refresh_bed_level() {
+  bilinear_grid_factor = bilinear_grid_spacing.reciprocal();
+  TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+  TERN_(ABL_BILINEAR_CELL_CACHE, bilinear_cells_update());
+}
+
 // Get the Z adjustment for non-linear bed leveling
 float bilinear_z_offset(const xy_pos_t &raw) {
 
+  #if ENABLED(ABL_BILINEAR_CELL_CACHE)
+
+    // Find the cell and the position within it, like the grid walk below
+    const xy_pos_t rel = raw - bilinear_start.asFloat();
+    xy_float_t ratio = { rel.x * ABL_BG_FACTOR(x), rel.y * ABL_BG_FACTOR(y) };
+    const uint8_t gx = constrain(FLOOR(ratio.x), 0, ABL_BG_POINTS_X - 2),
+                  gy = constrain(FLOOR(ratio.y), 0, ABL_BG_POINTS_Y - 2);
+    ratio.x -= gx;
+    ratio.y -= gy;
+
+    #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
+      // Beyond the grid maintain height at grid edges
+      LIMIT(ratio.x, 0, 1);
+      LIMIT(ratio.y, 0, 1);
+    #endif
+
+    const bilinear_cell_t &cell = bilinear_cells[gx][gy];
+    return cell.a + cell.b * ratio.x + (cell.c + cell.d * ratio.x) * ratio.y;
+
+  #else
+
   static float z1, d2, z3, d4, L, D;
 
   static xy_pos_t prev { -999.999, -999.999 }, ratio;
@@ -338,6 +414,8 @@ float bilinear_z_offset(const xy_pos_t &raw) {
   //*/
 
   return offset;
+
+  #endif // !ABL_BILINEAR_CELL_CACHE
 }
 
 #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
@@ -35,6 +35,9 @@ void refresh_bed_level();
   void print_bilinear_leveling_grid_virt();
   void bed_level_virt_interpolate();
 #endif
+#if ENABLED(ABL_BILINEAR_CELL_CACHE)
+  void bilinear_cells_update();
+#endif
 
 #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
   void bilinear_line_to_destination(const feedRate_t &scaled_fr_mm_s, uint16_t x_splits=0xFFFF, uint16_t y_splits=0xFFFF);
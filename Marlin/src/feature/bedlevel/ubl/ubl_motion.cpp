@@ -37,6 +37,76 @@
 
 #if !UBL_SEGMENTED
 
+  #ifdef LEVELED_SEGMENT_TOLERANCE
+
+    /**
+     * Hold back each mesh line crossing until the next one is known. A held crossing
+     * is dropped when the line past it stays within LEVELED_SEGMENT_TOLERANCE of all
+     * the crossings dropped since the last queued point. Each dropped crossing limits
+     * the slope of that line, so only the range of allowed slopes is kept.
+     */
+    static struct {
+      xyze_pos_t from, held;  // The last queued point and the crossing held back
+      float lo, hi;           // Allowed Z slope from 'from', per mm of |X| + |Y|
+      bool holding;
+    } crossing;
+
+    static void crossings_start(const xyze_pos_t &start, const xy_int8_t &istart) {
+      crossing.from = start;
+      crossing.holding = false;
+      // Off the mesh the previous move may have ended at another height,
+      // so keep the first crossing. Otherwise level the start as it did.
+      if (!WITHIN(istart.x, 0, GRID_MAX_POINTS_X - 2) || !WITHIN(istart.y, 0, GRID_MAX_POINTS_Y - 2)) {
+        crossing.lo = INFINITY;
+        crossing.hi = -INFINITY;
+        return;
+      }
+      const float z0 = ubl.get_z_correction(start) * planner.fade_scaling_factor_for_z(start.z);
+      if (!isnan(z0)) crossing.from.z += z0;
+      crossing.lo = -INFINITY;
+      crossing.hi = INFINITY;
+    }
+
+    static bool buffer_crossing(const float &rx, const float &ry, const float &rz, const float &e, const feedRate_t &fr_mm_s, const uint8_t extruder) {
+      if (crossing.holding) {
+        const xyze_pos_t &from = crossing.from, &held = crossing.held;
+        const float held_mm = ABS(held.x - from.x) + ABS(held.y - from.y),
+                    lo = _MAX(crossing.lo, (held.z - from.z - (LEVELED_SEGMENT_TOLERANCE)) / held_mm),
+                    hi = _MIN(crossing.hi, (held.z - from.z + (LEVELED_SEGMENT_TOLERANCE)) / held_mm),
+                    slope = (rz - from.z) / (ABS(rx - from.x) + ABS(ry - from.y));
+        if (WITHIN(slope, lo, hi)) {
+          crossing.lo = lo;
+          crossing.hi = hi;
+        }
+        else {
+          // The mesh bends at the held crossing
+          crossing.holding = false;
+          if (!planner.buffer_segment(crossing.held, fr_mm_s, extruder)) return false;
+          crossing.from = crossing.held;
+          crossing.lo = -INFINITY;
+          crossing.hi = INFINITY;
+        }
+      }
+      crossing.held.set(rx, ry, rz, e);
+      crossing.holding = true;
+      return true;
+    }
+
+    static bool crossings_finish(const feedRate_t &fr_mm_s, const uint8_t extruder) {
+      if (!crossing.holding) return true;
+      crossing.holding = false;
+      return planner.buffer_segment(crossing.held, fr_mm_s, extruder);
+    }
+
+  #else
+
+    FORCE_INLINE static bool buffer_crossing(const float &rx, const float &ry, const float &rz, const float &e, const feedRate_t &fr_mm_s, const uint8_t extruder) {
+      return planner.buffer_segment(rx, ry, rz, e, fr_mm_s, extruder);
+    }
+    FORCE_INLINE static bool crossings_finish(const feedRate_t&, const uint8_t) { return true; }
+
+  #endif
+
   void unified_bed_leveling::line_to_destination_cartesian(const feedRate_t &scaled_fr_mm_s, const uint8_t extruder) {
     /**
      * Much of the nozzle movement will be within the same cell. So we will do as little computation
@@ -93,7 +163,13 @@
       // Undefined parts of the Mesh in z_values[][] are NAN.
       // Replace NAN corrections with 0.0 to prevent NAN propagation.
       if (!isnan(z0)) end.z += z0;
-      planner.buffer_segment(end, scaled_fr_mm_s, extruder);
+      #ifdef LEVELED_SEGMENT_TOLERANCE
+        // The destination may let the last crossing go
+        if (buffer_crossing(end.x, end.y, end.z, end.e, scaled_fr_mm_s, extruder))
+          crossings_finish(scaled_fr_mm_s, extruder);
+      #else
+        planner.buffer_segment(end, scaled_fr_mm_s, extruder);
+      #endif
       current_position = destination;
       return;
     }
@@ -103,6 +179,10 @@
      * case - crossing only one X or Y line - after details are worked out to reduce computation.
      */
 
+    #ifdef LEVELED_SEGMENT_TOLERANCE
+      crossings_start(start, istart);
+    #endif
+
     const xy_float_t dist = end - start;
     const xy_bool_t neg { dist.x < 0, dist.y < 0 };
     const xy_int8_t ineg { int8_t(neg.x), int8_t(neg.y) };
@@ -177,7 +257,7 @@
             z_position = end.z;
           }
 
-          planner.buffer_segment(rx, ry, z_position + z0, e_position, scaled_fr_mm_s, extruder);
+          buffer_crossing(rx, ry, z_position + z0, e_position, scaled_fr_mm_s, extruder);
         } //else printf("FIRST MOVE PRUNED  ");
       }
 
@@ -185,6 +265,7 @@
       if (xy_pos_t(current_position) != xy_pos_t(end))
         goto FINAL_MOVE;
 
+      crossings_finish(scaled_fr_mm_s, extruder);
       current_position = destination;
       return;
     }
@@ -223,7 +304,7 @@
             z_position = end.z;
           }
 
-          if (!planner.buffer_segment(rx, ry, z_position + z0, e_position, scaled_fr_mm_s, extruder))
+          if (!buffer_crossing(rx, ry, z_position + z0, e_position, scaled_fr_mm_s, extruder))
             break;
         } //else printf("FIRST MOVE PRUNED  ");
       }
@@ -231,6 +312,7 @@
       if (xy_pos_t(current_position) != xy_pos_t(end))
         goto FINAL_MOVE;
 
+      crossings_finish(scaled_fr_mm_s, extruder);
       current_position = destination;
       return;
     }
@@ -273,7 +355,7 @@
           e_position = end.e;
           z_position = end.z;
         }
-        if (!planner.buffer_segment(rx, next_mesh_line_y, z_position + z0, e_position, scaled_fr_mm_s, extruder))
+        if (!buffer_crossing(rx, next_mesh_line_y, z_position + z0, e_position, scaled_fr_mm_s, extruder))
           break;
         icell.y += iadd.y;
         cnt.y--;
@@ -297,7 +379,7 @@
           z_position = end.z;
         }
 
-        if (!planner.buffer_segment(next_mesh_line_x, ry, z_position + z0, e_position, scaled_fr_mm_s, extruder))
+        if (!buffer_crossing(next_mesh_line_x, ry, z_position + z0, e_position, scaled_fr_mm_s, extruder))
           break;
         icell.x += iadd.x;
         cnt.x--;
@@ -309,6 +391,7 @@
     if (xy_pos_t(current_position) != xy_pos_t(end))
       goto FINAL_MOVE;
 
+    crossings_finish(scaled_fr_mm_s, extruder);
     current_position = destination;
   }
 
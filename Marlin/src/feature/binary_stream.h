@@ -29,6 +29,10 @@
   #include "../libs/heatshrink/heatshrink_decoder.h"
 #endif
 
+#if ENABLED(BINARY_NEOPIXEL_TRANSFER)
+  #include "leds/neopixel.h"
+#endif
+
 inline bool bs_serial_data_available(const uint8_t index) {
   switch (index) {
     case 0: return MYSERIAL0.available();
@@ -212,9 +216,98 @@ public:
   static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0, TIMEOUT = 10000, IDLE_PERIOD = 1000;
 };
 
+#if ENABLED(BINARY_NEOPIXEL_TRANSFER)
+
+/**
+ * Bulk NeoPixel upload. WRITE packets stage pixels and hold them off the
+ * strip until a SHOW packet commits the whole frame with one refresh.
+ * While held, other changes to the strip are staged too. If no SHOW comes,
+ * the hold ends HOLD_TIMEOUT ms after the last WRITE, or at the next M150.
+ * A WRITE or SHOW for a strip that doesn't exist answers PLED:invalid.
+ */
+class NeoPixelTransferProtocol {
+private:
+  struct Packet {
+    struct [[gnu::packed]] Write {
+      static bool validate(const size_t length) { return length >= sizeof(Write); }
+      static Write& decode(char* buffer) { return *reinterpret_cast<Write*>(buffer); }
+      uint8_t bytes_per_pixel() const { return (flags & 0x1) ? 4 : 3; }
+      uint8_t strip,  // 0 = neo, 1 = neo2
+              flags;  // bit 0: pixels include a white channel
+      uint16_t start; // index of the first pixel
+      // followed by R,G,B[,W] bytes for each pixel
+    };
+  };
+
+  enum class LEDTransfer : uint8_t { QUERY, WRITE, SHOW };
+
+  static bool valid_strip(const uint8_t strip) { return strip < 1 + ENABLED(NEOPIXEL2_SEPARATE); }
+
+  static void write(const Packet::Write &packet, const uint8_t *data, const uint16_t length) {
+    const uint8_t bpp = packet.bytes_per_pixel();
+    uint16_t n = packet.start;
+    #if ENABLED(NEOPIXEL2_SEPARATE)
+      if (packet.strip) {
+        neo2.hold_for(HOLD_TIMEOUT);
+        for (uint16_t i = 0; i + bpp <= length && n < neo2.pixels(); i += bpp, ++n)
+          neo2.set_pixel_color(n, neo2.Color(data[i], data[i + 1], data[i + 2], bpp > 3 ? data[i + 3] : 0));
+        return;
+      }
+    #endif
+    neo.hold_for(HOLD_TIMEOUT);
+    for (uint16_t i = 0; i + bpp <= length && n < neo.pixels(); i += bpp, ++n)
+      neo.set_pixel_color(n, neo.Color(data[i], data[i + 1], data[i + 2], bpp > 3 ? data[i + 3] : 0));
+  }
+
+  static void show(const uint8_t strip) {
+    #if ENABLED(NEOPIXEL2_SEPARATE)
+      if (strip) { neo2.hold = false; neo2.commit(); return; }
+    #else
+      UNUSED(strip);
+    #endif
+    neo.hold = false;
+    neo.commit();
+  }
+
+public:
+  static void process(uint8_t packet_type, char* buffer, const uint16_t length) {
+    switch (static_cast<LEDTransfer>(packet_type)) {
+      case LEDTransfer::QUERY:
+        SERIAL_ECHOPAIR("PLED:version:", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH, ":pixels:", neo.pixels());
+        TERN_(NEOPIXEL2_SEPARATE, SERIAL_ECHOPAIR(",", neo2.pixels()));
+        SERIAL_EOL();
+        break;
+      case LEDTransfer::WRITE:
+        if (Packet::Write::validate(length)) {
+          auto &packet = Packet::Write::decode(buffer);
+          if (valid_strip(packet.strip)) {
+            write(packet, reinterpret_cast<uint8_t*>(&buffer[sizeof(Packet::Write)]), length - sizeof(Packet::Write));
+            break;
+          }
+        }
+        SERIAL_ECHOLNPGM("PLED:invalid");
+        break;
+      case LEDTransfer::SHOW: {
+        const uint8_t strip = length ? buffer[0] : 0;
+        if (valid_strip(strip))
+          show(strip);
+        else
+          SERIAL_ECHOLNPGM("PLED:invalid");
+      } break;
+      default:
+        SERIAL_ECHOLNPGM("PLED:invalid");
+        break;
+    }
+  }
+
+  static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0, HOLD_TIMEOUT = 1000;
+};
+
+#endif // BINARY_NEOPIXEL_TRANSFER
+
 class BinaryStream {
 public:
-  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER };
+  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER, NEOPIXEL };
 
   enum class ProtocolControl : uint8_t { SYNC = 1, CLOSE };
 
@@ -454,6 +547,11 @@ public:
       case Protocol::FILE_TRANSFER:
         SDFileTransferProtocol::process(packet.header.type(), packet.buffer, packet.header.size); // send user data to be processed
       break;
+      #if ENABLED(BINARY_NEOPIXEL_TRANSFER)
+        case Protocol::NEOPIXEL:
+          NeoPixelTransferProtocol::process(packet.header.type(), packet.buffer, packet.header.size);
+        break;
+      #endif
       default:
         SERIAL_ECHO_MSG("Unsupported Binary Protocol");
     }
@@ -42,6 +42,10 @@
   #include "pca9533.h"
 #endif
 
+#if ENABLED(NEOPIXEL_EFFECTS)
+  #include "neopixel_fx.h"
+#endif
+
 #if ENABLED(LED_COLOR_PRESETS)
   const LEDColor LEDLights::defaultLEDColor = MakeLEDColor(
     LED_USER_PRESET_RED, LED_USER_PRESET_GREEN, LED_USER_PRESET_BLUE,
@@ -78,29 +82,32 @@ void LEDLights::set_color(const LEDColor &incol
 
   #if ENABLED(NEOPIXEL_LED)
 
-    const uint32_t neocolor = LEDColorWhite() == incol
-                            ? neo.Color(NEO_WHITE)
-                            : neo.Color(incol.r, incol.g, incol.b, incol.w);
-    static uint16_t nextLed = 0;
-
-    #ifdef NEOPIXEL_BKGD_LED_INDEX
-      if (NEOPIXEL_BKGD_LED_INDEX == nextLed) {
+    // A running effect owns the strip, but the other LEDs still follow
+    if (TERN1(NEOPIXEL_EFFECTS, !neofx.is_active(0))) {
+      const uint32_t neocolor = LEDColorWhite() == incol
+                              ? neo.Color(NEO_WHITE)
+                              : neo.Color(incol.r, incol.g, incol.b, incol.w);
+      static uint16_t nextLed = 0;
+
+      #ifdef NEOPIXEL_BKGD_LED_INDEX
+        if (NEOPIXEL_BKGD_LED_INDEX == nextLed) {
+          if (++nextLed >= neo.pixels()) nextLed = 0;
+          return;
+        }
+      #endif
+
+      neo.set_brightness(incol.i);
+
+      if (isSequence) {
+        neo.set_pixel_color(nextLed, neocolor);
+        neo.commit();
         if (++nextLed >= neo.pixels()) nextLed = 0;
         return;
       }
-    #endif
 
-    neo.set_brightness(incol.i);
-
-    if (isSequence) {
-      neo.set_pixel_color(nextLed, neocolor);
-      neo.show();
-      if (++nextLed >= neo.pixels()) nextLed = 0;
-      return;
+      neo.set_color(neocolor);
     }
 
-    neo.set_color(neocolor);
-
   #endif
 
   #if ENABLED(BLINKM)
@@ -178,11 +185,14 @@ void LEDLights::set_color(const LEDColor &incol
   }
 
   void LEDLights2::set_color(const LEDColor &incol) {
-    const uint32_t neocolor = LEDColorWhite() == incol
-                            ? neo2.Color(NEO2_WHITE)
-                            : neo2.Color(incol.r, incol.g, incol.b, incol.w);
-    neo2.set_brightness(incol.i);
-    neo2.set_color(neocolor);
+    // A running effect owns the strip, but the color is still remembered
+    if (TERN1(NEOPIXEL_EFFECTS, !neofx.is_active(1))) {
+      const uint32_t neocolor = LEDColorWhite() == incol
+                              ? neo2.Color(NEO2_WHITE)
+                              : neo2.Color(incol.r, incol.g, incol.b, incol.w);
+      neo2.set_brightness(incol.i);
+      neo2.set_color(neocolor);
+    }
 
     #if ENABLED(LED_CONTROL_MENU)
       // Don't update the color when OFF
@@ -34,8 +34,22 @@
   #include "../../core/utility.h"
 #endif
 
+#if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+  #include "../../module/planner.h"
+
+  // Strip refreshes run with interrupts off. Don't add one while moves are
+  // running on a nearly empty planner buffer.
+  inline bool neo_frame_ready(const millis_t &next_frame_ms) {
+    return ELAPSED(millis(), next_frame_ms)
+      && !(planner.has_blocks_queued() && planner.movesplanned() < (NEOPIXEL_MIN_PLANNED_BLOCKS));
+  }
+#endif
+
 Marlin_NeoPixel neo;
-int8_t Marlin_NeoPixel::neoindex;
+int16_t Marlin_NeoPixel::neoindex;
+uint16_t Marlin_NeoPixel::neocount;
+bool Marlin_NeoPixel::hold; // = false
+millis_t Marlin_NeoPixel::hold_ms; // = 0
 
 Adafruit_NeoPixel Marlin_NeoPixel::adaneo1(NEOPIXEL_PIXELS, NEOPIXEL_PIN, NEOPIXEL_TYPE + NEO_KHZ800)
   #if CONJOINED_NEOPIXEL
@@ -43,6 +57,25 @@ Adafruit_NeoPixel Marlin_NeoPixel::adaneo1(NEOPIXEL_PIXELS, NEOPIXEL_PIN, NEOPIX
   #endif
 ;
 
+#if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+
+  decltype(Marlin_NeoPixel::frame) Marlin_NeoPixel::frame;
+  millis_t Marlin_NeoPixel::next_frame_ms; // = 0
+
+  // Copy changed pixels to the front buffer before sending it
+  void Marlin_NeoPixel::refresh() {
+    for (uint16_t i = frame.dirty_first; i < frame.dirty_end; ++i)
+      write_pixel_color(i, frame.color[i]);
+    frame.clean();
+    next_frame_ms = millis() + (NEOPIXEL_FRAME_MS);
+  }
+
+  void Marlin_NeoPixel::idle_task() {
+    if (!held() && frame.is_dirty() && neo_frame_ready(next_frame_ms)) show();
+  }
+
+#endif
+
 #ifdef NEOPIXEL_BKGD_LED_INDEX
 
   void Marlin_NeoPixel::set_color_background() {
@@ -54,8 +87,10 @@ Adafruit_NeoPixel Marlin_NeoPixel::adaneo1(NEOPIXEL_PIXELS, NEOPIXEL_PIN, NEOPIX
 
 void Marlin_NeoPixel::set_color(const uint32_t color) {
   if (neoindex >= 0) {
-    set_pixel_color(neoindex, color);
+    const uint16_t end = _MIN(neoindex + neocount, pixels());
+    for (uint16_t i = neoindex; i < end; ++i) set_pixel_color(i, color);
     neoindex = -1;
+    neocount = 1;
   }
   else {
     for (uint16_t i = 0; i < pixels(); ++i) {
@@ -68,7 +103,7 @@ void Marlin_NeoPixel::set_color(const uint32_t color) {
       set_pixel_color(i, color);
     }
   }
-  show();
+  commit();
 }
 
 void Marlin_NeoPixel::set_color_startup(const uint32_t color) {
@@ -79,6 +114,7 @@ void Marlin_NeoPixel::set_color_startup(const uint32_t color) {
 
 void Marlin_NeoPixel::init() {
   neoindex = -1;                       // -1 .. NEOPIXEL_PIXELS-1 range
+  neocount = 1;
   set_brightness(NEOPIXEL_BRIGHTNESS); //  0 .. 255 range
   begin();
   show();  // initialize to all off
@@ -124,19 +160,42 @@ bool Marlin_NeoPixel::set_led_color(const uint8_t r, const uint8_t g, const uint
 
   Marlin_NeoPixel2 neo2;
 
-  int8_t Marlin_NeoPixel2::neoindex;
+  int16_t Marlin_NeoPixel2::neoindex;
+  uint16_t Marlin_NeoPixel2::neocount;
+  bool Marlin_NeoPixel2::hold; // = false
+  millis_t Marlin_NeoPixel2::hold_ms; // = 0
   Adafruit_NeoPixel Marlin_NeoPixel2::adaneo(NEOPIXEL2_PIXELS, NEOPIXEL2_PIN, NEOPIXEL2_TYPE);
 
+  #if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+
+    decltype(Marlin_NeoPixel2::frame) Marlin_NeoPixel2::frame;
+    millis_t Marlin_NeoPixel2::next_frame_ms; // = 0
+
+    void Marlin_NeoPixel2::refresh() {
+      for (uint16_t i = frame.dirty_first; i < frame.dirty_end; ++i)
+        adaneo.setPixelColor(i, frame.color[i]);
+      frame.clean();
+      next_frame_ms = millis() + (NEOPIXEL_FRAME_MS);
+    }
+
+    void Marlin_NeoPixel2::idle_task() {
+      if (!held() && frame.is_dirty() && neo_frame_ready(next_frame_ms)) show();
+    }
+
+  #endif
+
   void Marlin_NeoPixel2::set_color(const uint32_t color) {
     if (neoindex >= 0) {
-      set_pixel_color(neoindex, color);
+      const uint16_t end = _MIN(neoindex + neocount, pixels());
+      for (uint16_t i = neoindex; i < end; ++i) set_pixel_color(i, color);
       neoindex = -1;
+      neocount = 1;
     }
     else {
       for (uint16_t i = 0; i < pixels(); ++i)
         set_pixel_color(i, color);
     }
-    show();
+    commit();
   }
 
   void Marlin_NeoPixel2::set_color_startup(const uint32_t color) {
@@ -147,6 +206,7 @@ bool Marlin_NeoPixel::set_led_color(const uint8_t r, const uint8_t g, const uint
 
   void Marlin_NeoPixel2::init() {
     neoindex = -1;                        // -1 .. NEOPIXEL2_PIXELS-1 range
+    neocount = 1;
     set_brightness(NEOPIXEL2_BRIGHTNESS); //  0 .. 255 range
     begin();
     show();  // initialize to all off
@@ -58,6 +58,35 @@
   #define NEO_WHITE 0, 0, 0, 255
 #endif
 
+#if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+
+  /**
+   * NeoPixel back buffer
+   *
+   * Colors are staged here at full brightness. The Adafruit pixel buffer
+   * serves as the front buffer and only receives the range that changed
+   * since the last refresh.
+   */
+  template<uint16_t PIXELS>
+  class NeoFrameBuffer {
+  public:
+    uint32_t color[PIXELS];
+    uint16_t dirty_first, dirty_end;  // Changed pixels in [first, end)
+
+    inline bool is_dirty() const { return dirty_first < dirty_end; }
+    inline void set_all_dirty() { dirty_first = 0; dirty_end = PIXELS; }
+    inline void clean() { dirty_first = PIXELS; dirty_end = 0; }
+
+    inline void set(const uint16_t n, const uint32_t c) {
+      if (n >= PIXELS || color[n] == c) return;
+      color[n] = c;
+      NOMORE(dirty_first, n);
+      NOLESS(dirty_end, n + 1);
+    }
+  };
+
+#endif
+
 // ------------------------
 // Function prototypes
 // ------------------------
@@ -70,8 +99,30 @@ private:
     #endif
   ;
 
+  // Send a color to the Adafruit buffer(s)
+  static inline void write_pixel_color(const uint16_t n, const uint32_t c) {
+    #if ENABLED(NEOPIXEL2_INSERIES)
+      if (n >= NEOPIXEL_PIXELS) adaneo2.setPixelColor(n - (NEOPIXEL_PIXELS), c);
+      else adaneo1.setPixelColor(n, c);
+    #else
+      adaneo1.setPixelColor(n, c);
+      #if MULTIPLE_NEOPIXEL_TYPES
+        adaneo2.setPixelColor(n, c);
+      #endif
+    #endif
+  }
+
+  #if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+    static NeoFrameBuffer<TERN(NEOPIXEL2_INSERIES, (NEOPIXEL_PIXELS) * 2, NEOPIXEL_PIXELS)> frame;
+    static millis_t next_frame_ms;
+    static void refresh();
+  #endif
+
 public:
-  static int8_t neoindex;
+  static int16_t neoindex;  // First pixel for set_color, or -1 for all
+  static uint16_t neocount; // Number of pixels starting at neoindex
+  static bool hold;         // Keep staged changes off the strip until released
+  static millis_t hold_ms;  // ...or until this time, if not 0
 
   static void init();
   static void set_color_startup(const uint32_t c);
@@ -88,29 +139,41 @@ public:
   }
 
   static inline void set_pixel_color(const uint16_t n, const uint32_t c) {
-    #if ENABLED(NEOPIXEL2_INSERIES)
-      if (n >= NEOPIXEL_PIXELS) adaneo2.setPixelColor(n - (NEOPIXEL_PIXELS), c);
-      else adaneo1.setPixelColor(n, c);
-    #else
-      adaneo1.setPixelColor(n, c);
-      #if MULTIPLE_NEOPIXEL_TYPES
-        adaneo2.setPixelColor(n, c);
-      #endif
-    #endif
+    TERN(NEOPIXEL_DEFERRED_SHOW, frame.set(n, c), write_pixel_color(n, c));
   }
 
   static inline void set_brightness(const uint8_t b) {
+    #if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+      if (b == brightness()) return;
+      frame.set_all_dirty(); // Re-send unscaled colors on the next refresh
+    #endif
     adaneo1.setBrightness(b);
     TERN_(CONJOINED_NEOPIXEL, adaneo2.setBrightness(b));
   }
 
+  // Hold staged changes for a limited time, in case they are never released
+  static inline void hold_for(const millis_t ms) { hold = true; hold_ms = millis() + ms; if (!hold_ms) hold_ms = 1; }
+  static inline bool held() {
+    if (hold && hold_ms && ELAPSED(millis(), hold_ms)) hold = false;
+    return hold;
+  }
+
+  // Refresh the strip now, or leave it to idle() with NEOPIXEL_DEFERRED_SHOW
+  static inline void commit() { if (!held()) TERN(NEOPIXEL_DEFERRED_SHOW, NOOP, show()); }
+
+  #if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+    static void idle_task();
+  #endif
+
   static inline void show() {
+    TERN_(NEOPIXEL_DEFERRED_SHOW, refresh());
     adaneo1.show();
     #if PIN_EXISTS(NEOPIXEL2)
       #if CONJOINED_NEOPIXEL
         adaneo2.show();
-      #else
-        TERN(NEOPIXEL2_SEPARATE,,adaneo1.setPin(NEOPIXEL2_PIN));
+      #elif DISABLED(NEOPIXEL2_SEPARATE)
+        // Mirror the same pixels on the second strip
+        adaneo1.setPin(NEOPIXEL2_PIN);
         adaneo1.show();
         adaneo1.setPin(NEOPIXEL_PIN);
       #endif
@@ -150,8 +213,17 @@ extern Marlin_NeoPixel neo;
   private:
     static Adafruit_NeoPixel adaneo;
 
+    #if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+      static NeoFrameBuffer<NEOPIXEL2_PIXELS> frame;
+      static millis_t next_frame_ms;
+      static void refresh();
+    #endif
+
   public:
-    static int8_t neoindex;
+    static int16_t neoindex;
+    static uint16_t neocount;
+    static bool hold;
+    static millis_t hold_ms;
 
     static void init();
     static void set_color_startup(const uint32_t c);
@@ -159,11 +231,28 @@ extern Marlin_NeoPixel neo;
     static void set_color(const uint32_t c);
 
     static inline void begin() { adaneo.begin(); }
-    static inline void set_pixel_color(const uint16_t n, const uint32_t c) { adaneo.setPixelColor(n, c); }
-    static inline void set_brightness(const uint8_t b) { adaneo.setBrightness(b); }
+    static inline void set_pixel_color(const uint16_t n, const uint32_t c) {
+      TERN(NEOPIXEL_DEFERRED_SHOW, frame.set(n, c), adaneo.setPixelColor(n, c));
+    }
+    static inline void set_brightness(const uint8_t b) {
+      #if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+        if (b == brightness()) return;
+        frame.set_all_dirty();
+      #endif
+      adaneo.setBrightness(b);
+    }
+    static inline void hold_for(const millis_t ms) { hold = true; hold_ms = millis() + ms; if (!hold_ms) hold_ms = 1; }
+    static inline bool held() {
+      if (hold && hold_ms && ELAPSED(millis(), hold_ms)) hold = false;
+      return hold;
+    }
+    static inline void commit() { if (!held()) TERN(NEOPIXEL_DEFERRED_SHOW, NOOP, show()); }
+    #if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+      static void idle_task();
+    #endif
     static inline void show() {
+      TERN_(NEOPIXEL_DEFERRED_SHOW, refresh());
       adaneo.show();
-      adaneo.setPin(NEOPIXEL2_PIN);
     }
 
     // Accessors
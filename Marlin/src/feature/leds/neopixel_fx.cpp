@@ -0,0 +1,109 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * neopixel_fx.cpp - NeoPixel animations driven by printer state
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(NEOPIXEL_EFFECTS)
+
+#include "neopixel_fx.h"
+#include "../../module/temperature.h"
+
+#if ENABLED(SDSUPPORT)
+  #include "../../sd/cardreader.h"
+#endif
+
+NeoPixelEffects neofx;
+
+millis_t NeoPixelEffects::next_frame_ms; // = 0
+NeoPixelEffect NeoPixelEffects::effect[NEOPIXEL_STRIPS]; // = { NEOFX_NONE }
+LEDColor NeoPixelEffects::color[NEOPIXEL_STRIPS];        // = white
+
+inline uint8_t fx_scale(const uint8_t c, const uint8_t f) { return (uint16_t(c) * f + 255) >> 8; }
+
+void NeoPixelEffects::set_effect(const uint8_t s, const NeoPixelEffect fx) {
+  if (s >= NEOPIXEL_STRIPS) return;
+  effect[s] = fx < NEOFX_COUNT ? fx : NEOFX_NONE;
+  next_frame_ms = 0; // Draw the new effect right away
+}
+
+/**
+ * Draw one frame of the strip's effect. Unchanged pixels are
+ * filtered out by the NeoPixel back buffer.
+ */
+template<class NEO>
+void NeoPixelEffects::render(NEO &strip, const uint8_t s, const millis_t &ms) {
+  const LEDColor &c = color[s];
+  const uint16_t count = strip.pixels();
+
+  switch (effect[s]) {
+    default: return;
+
+    case NEOFX_PROGRESS: {
+      // Fill in proportion to the job, fading in the last pixel
+      const uint32_t fill = uint32_t(TERN0(SDSUPPORT, card.percentDone())) * count * 255 / 100;
+      LOOP_L_N(i, count) {
+        const uint32_t lit = uint32_t(i) * 255;
+        const uint8_t f = fill >= lit + 255 ? 255 : fill > lit ? fill - lit : 0;
+        strip.set_pixel_color(i, strip.Color(fx_scale(c.r, f), fx_scale(c.g, f), fx_scale(c.b, f), fx_scale(c.w, f)));
+      }
+    } break;
+
+    #if HAS_HOTEND
+      case NEOFX_HEAT: {
+        // Split the strip between hotends. Each part fills from blue to red as it heats.
+        const uint16_t seg = _MAX(count / (HOTENDS), 1);
+        LOOP_L_N(i, count) {
+          const uint8_t e = _MIN(i / seg, (HOTENDS) - 1);
+          const int16_t target = thermalManager.degTargetHotend(e);
+          const float ratio = thermalManager.degHotend(e) / float(target ?: thermalManager.heater_maxtemp[e]);
+          const uint16_t pos = i - e * seg, lit = LROUND(constrain(ratio, 0, 1) * seg);
+          const uint8_t hue = pos * 255 / _MAX(seg - 1, 1);
+          strip.set_pixel_color(i, pos < lit ? strip.Color(hue, 0, 255 - hue, 0) : 0);
+        }
+      } break;
+    #endif
+
+    case NEOFX_BREATHE: {
+      // Triangle wave from off to full over NEOPIXEL_BREATHE_MS
+      const uint16_t phase = ms % (NEOPIXEL_BREATHE_MS);
+      const uint8_t f = (phase < (NEOPIXEL_BREATHE_MS) / 2 ? phase : (NEOPIXEL_BREATHE_MS) - phase) * 510UL / (NEOPIXEL_BREATHE_MS);
+      const uint32_t neocolor = strip.Color(fx_scale(c.r, f), fx_scale(c.g, f), fx_scale(c.b, f), fx_scale(c.w, f));
+      LOOP_L_N(i, count) strip.set_pixel_color(i, neocolor);
+    } break;
+  }
+}
+
+void NeoPixelEffects::idle_task() {
+  const millis_t ms = millis();
+  if (PENDING(ms, next_frame_ms)) return;
+  next_frame_ms = ms + (NEOPIXEL_EFFECTS_FRAME_MS);
+  if (is_active(0)) render(neo, 0, ms);
+  #if ENABLED(NEOPIXEL2_SEPARATE)
+    if (is_active(1)) render(neo2, 1, ms);
+  #endif
+}
+
+#endif // NEOPIXEL_EFFECTS
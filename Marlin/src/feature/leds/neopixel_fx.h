@@ -0,0 +1,58 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * neopixel_fx.h - NeoPixel animations driven by printer state
+ */
+
+#include "leds.h"
+
+#define NEOPIXEL_STRIPS TERN(NEOPIXEL2_SEPARATE, 2, 1)
+
+enum NeoPixelEffect : uint8_t {
+  NEOFX_NONE,       // Strip is set with M150
+  NEOFX_PROGRESS,   // Print progress bar
+  NEOFX_HEAT,       // One blue-to-red gradient per hotend
+  NEOFX_BREATHE,    // Slowly pulse the effect color
+  NEOFX_COUNT
+};
+
+class NeoPixelEffects {
+private:
+  static millis_t next_frame_ms;
+
+  template<class NEO>
+  static void render(NEO &strip, const uint8_t s, const millis_t &ms);
+
+public:
+  static NeoPixelEffect effect[NEOPIXEL_STRIPS];
+  static LEDColor color[NEOPIXEL_STRIPS];
+
+  static void set_effect(const uint8_t s, const NeoPixelEffect fx);
+
+  static inline bool is_active(const uint8_t s) { return effect[s] != NEOFX_NONE; }
+
+  static void idle_task();
+};
+
+extern NeoPixelEffects neofx;
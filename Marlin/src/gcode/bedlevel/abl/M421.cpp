@@ -63,6 +63,7 @@ void GcodeSuite::M421() {
         }
       }
       TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+      TERN_(ABL_BILINEAR_CELL_CACHE, bilinear_cells_update());
     }
     else
       SERIAL_ERROR_MSG(STR_ERR_MESH_XY);
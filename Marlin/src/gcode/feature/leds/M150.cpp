@@ -27,6 +27,10 @@
 #include "../../gcode.h"
 #include "../../../feature/leds/leds.h"
 
+#if ENABLED(NEOPIXEL_EFFECTS)
+  #include "../../../feature/leds/neopixel_fx.h"
+#endif
+
 /**
  * M150: Set Status LED Color - Use R-U-B-W for R-G-B-W
  *       and Brightness       - Use P (for NEOPIXEL only)
@@ -36,6 +40,10 @@
  *
  * With NEOPIXEL_LED:
  *  I<index>  Set the NeoPixel index to affect. Default: All
+ *  C<count>  Number of pixels to set, starting at I<index>. Default: 1
+ *  D         Defer the strip refresh. Stage more pixels with M150 D, then
+ *            commit them all with a final M150 (without D). This also
+ *            shows pixels held by a binary upload.
  *
  * With NEOPIXEL2_SEPARATE:
  *  S<index>  The NeoPixel strip to set. Default is index 0.
@@ -51,19 +59,31 @@
  *   M150 P          ; Set LED full brightness
  *   M150 I1 R       ; Set NEOPIXEL index 1 to red
  *   M150 S1 I1 R    ; Set SEPARATE index 1 to red
+ *   M150 I4 C8 B D  ; Stage pixels 4-11 as blue
+ *   M150 I0 C4 R    ; Set pixels 0-3 to red and show all staged pixels
  */
 
 void GcodeSuite::M150() {
   #if ENABLED(NEOPIXEL_LED)
-    const uint8_t index = parser.intval('I', -1);
+    const int16_t index = parser.intval('I', -1);
+    const uint16_t count = _MAX(parser.ushortval('C', 1), 1);
+    const bool hold = parser.seen('D');
     #if ENABLED(NEOPIXEL2_SEPARATE)
       const uint8_t unit = parser.intval('S'),
                     brightness = unit ? neo2.brightness() : neo.brightness();
       *(unit ? &neo2.neoindex : &neo.neoindex) = index;
+      *(unit ? &neo2.neocount : &neo.neocount) = count;
+      *(unit ? &neo2.hold : &neo.hold) = hold;
+      *(unit ? &neo2.hold_ms : &neo.hold_ms) = 0;
     #else
       const uint8_t brightness = neo.brightness();
       neo.neoindex = index;
+      neo.neocount = count;
+      neo.hold = hold;
+      neo.hold_ms = 0;
     #endif
+    // Take the strip back from any running effect
+    TERN_(NEOPIXEL_EFFECTS, neofx.set_effect(TERN0(NEOPIXEL2_SEPARATE, unit), NEOFX_NONE));
   #endif
 
   const LEDColor color = MakeLEDColor(
@@ -0,0 +1,68 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(NEOPIXEL_EFFECTS)
+
+#include "../../gcode.h"
+#include "../../../feature/leds/neopixel_fx.h"
+
+/**
+ * M151: Set NeoPixel Effect
+ *
+ *  E<effect>  0 = None (use M150)
+ *             1 = Print progress bar
+ *             2 = Hotend heat gradients
+ *             3 = Breathing
+ *  S<index>   The NeoPixel strip to set (NEOPIXEL2_SEPARATE). Default is index 0.
+ *  R U B W    Effect color. Components left out are set to 0.
+ *             If all are left out the color is unchanged.
+ *
+ * With no E parameter report the current effect.
+ *
+ * Examples:
+ *
+ *   M151 E1 U255    ; Green progress bar
+ *   M151 S1 E2      ; Heat gradients on the second strip
+ *   M151 E3 B       ; Breathe blue
+ *   M151 E0         ; Stop the effect
+ */
+void GcodeSuite::M151() {
+  const uint8_t unit = parser.byteval('S');
+  if (unit >= NEOPIXEL_STRIPS) return;
+
+  if (parser.seen("RUBW")) {
+    LEDColor &c = neofx.color[unit];
+    c.r = parser.seen('R') ? (parser.has_value() ? parser.value_byte() : 255) : 0;
+    c.g = parser.seen('U') ? (parser.has_value() ? parser.value_byte() : 255) : 0;
+    c.b = parser.seen('B') ? (parser.has_value() ? parser.value_byte() : 255) : 0;
+    c.w = parser.seen('W') ? (parser.has_value() ? parser.value_byte() : 255) : 0;
+  }
+
+  if (parser.seenval('E'))
+    neofx.set_effect(unit, (NeoPixelEffect)parser.value_byte());
+  else
+    SERIAL_ECHOLNPAIR("NeoPixel ", int(unit), " effect: ", int(neofx.effect[unit]));
+}
+
+#endif // NEOPIXEL_EFFECTS
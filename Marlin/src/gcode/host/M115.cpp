@@ -59,6 +59,9 @@ void GcodeSuite::M115() {
     // BINARY_FILE_TRANSFER (M28 B1)
     cap_line(PSTR("BINARY_FILE_TRANSFER"), ENABLED(BINARY_FILE_TRANSFER));
 
+    // BINARY_NEOPIXEL_TRANSFER (M28 B1, NeoPixel protocol)
+    cap_line(PSTR("BINARY_NEOPIXEL_TRANSFER"), ENABLED(BINARY_NEOPIXEL_TRANSFER));
+
     // EEPROM (M500, M501)
     cap_line(PSTR("EEPROM"), ENABLED(EEPROM_SETTINGS));
 
@@ -40,6 +40,19 @@
   #define N_ARC_CORRECTION 1
 #endif
 
+#if ENABLED(ARC_BLOCKS)
+  // Would the whole circle stay within the soft endstops? The stepper can't clamp chords.
+  static bool arc_within_limits(const xy_pos_t &center, const float radius) {
+    xyz_pos_t lo = current_position, hi = current_position;
+    lo.x = center.x - radius; lo.y = center.y - radius;
+    hi.x = center.x + radius; hi.y = center.y + radius;
+    const xyz_pos_t lo0 = lo, hi0 = hi;
+    apply_motion_limits(lo);
+    apply_motion_limits(hi);
+    return lo.x == lo0.x && lo.y == lo0.y && hi.x == hi0.x && hi.y == hi0.y;
+  }
+#endif
+
 /**
  * Plan an arc in 2 dimensions
  *
@@ -118,6 +131,21 @@ void plan_arc(
   NOLESS(segments, min_segments);         // At least some segments
   seg_length = mm_of_travel / segments;
 
+  #if ENABLED(ARC_BLOCKS)
+    // An arc in the XY plane, with no leveling to bend it, goes to the planner as one block
+    if ( TERN1(CNC_WORKSPACE_PLANES, p_axis == X_AXIS)
+      && !TERN0(HAS_LEVELING, planner.leveling_active)
+      && arc_within_limits({ center_P, center_Q }, radius)
+    ) {
+      xyze_pos_t raw = cart;
+      TERN_(AUTO_BED_LEVELING_UBL, raw[l_axis] = start_L);
+      apply_motion_limits(raw);
+      planner.buffer_arc(raw, offset, angular_travel, segments, scaled_fr_mm_s, active_extruder, mm_of_travel);
+      current_position = raw;
+      return;
+    }
+  #endif
+
   /**
    * Vector rotation by transformation matrix: r is the original vector, r_T is the rotated vector,
    * and phi is the angle of rotation. Based on the solution approach by Jens Geisler.
@@ -66,6 +66,11 @@ int GCodeParser::codenum;
   // Optimized Parameters
   uint32_t GCodeParser::codebits;  // found bits
   uint8_t GCodeParser::param[26];  // parameter offsets from command_ptr
+  #if ENABLED(FASTER_GCODE_VALUES)
+    uint32_t GCodeParser::param_digits[26]; // parameter values as digits
+    uint8_t GCodeParser::param_places[26],  // decimal places and sign
+            GCodeParser::value_ind;         // last seen parameter
+  #endif
 #else
   char *GCodeParser::command_args; // start of parameters
 #endif
@@ -90,6 +95,84 @@ void GCodeParser::reset() {
   #endif
 }
 
+#if ENABLED(FASTER_GCODE_VALUES)
+
+  #define VALUE_NEGATIVE  0x80            // Sign bit in param_places
+  #define VALUE_SATURATED 0x40            // Set in param_places when the whole part didn't fit 32 bits
+  #define VALUE_PLACES(I) (param_places[I] & ~(VALUE_NEGATIVE | VALUE_SATURATED))
+
+  static const uint32_t pow10_long[] PROGMEM = {
+    1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+  };
+  static const float pow10_float[] PROGMEM = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f
+  };
+
+  /**
+   * Convert a value like [-+]?[0-9]*.?[0-9]* just once, while parsing.
+   * Digits are kept without the decimal point so the value can be read
+   * as an integer (truncated and saturated, like strtol) or as a float.
+   * Fraction digits past 32 bits or 9 places are dropped, and a whole part
+   * too big for 32 bits saturates. Like value_float, 'E' ends the value,
+   * so there is no scientific notation.
+   */
+  void GCodeParser::set_value(const uint8_t ind, const char *p) {
+    uint8_t places = 0;
+    if (*p == '-') { places = VALUE_NEGATIVE; p++; }
+    else if (*p == '+') p++;
+
+    uint32_t digits = 0;
+    bool point = false;
+    for (;; p++) {
+      const char c = *p;
+      if (c == '.' && !point) { point = true; continue; }
+      if (!NUMERIC(c)) break;
+      if (point && (places & ~VALUE_NEGATIVE) >= COUNT(pow10_long) - 1) continue; // Drop tiny fractions
+      if (digits < 429496729UL || (digits == 429496729UL && c <= '5')) {
+        digits = digits * 10 + (c - '0');
+        if (point) places++;
+      }
+      else if (!point) {                    // Too big for 32 bits
+        digits = UINT32_MAX;
+        places = (places & VALUE_NEGATIVE) | VALUE_SATURATED;
+        break;
+      }
+    }
+
+    param_digits[ind] = digits;
+    param_places[ind] = places;
+  }
+
+  // Digits over 24 bits are rounded to float before the division, so
+  // this can be 1 ulp away from strtof.
+  float GCodeParser::param_float(const uint8_t ind) {
+    const uint8_t places = VALUE_PLACES(ind);
+    float f = param_digits[ind];
+    if (places) f /= pgm_read_float(&pow10_float[places]);
+    return (param_places[ind] & VALUE_NEGATIVE) ? -f : f;
+  }
+
+  // The whole part, saturated to the int32_t range like strtol
+  int32_t GCodeParser::param_long(const uint8_t ind) {
+    const uint8_t places = VALUE_PLACES(ind);
+    uint32_t u = param_digits[ind];
+    if (places) u /= pgm_read_dword(&pow10_long[places]);
+    if (param_places[ind] & VALUE_NEGATIVE)
+      return u > 0x80000000UL ? INT32_MIN : int32_t(0UL - u);
+    return u > uint32_t(INT32_MAX) ? INT32_MAX : int32_t(u);
+  }
+
+  // The whole part, negated modulo 2^32 and saturated like strtoul
+  uint32_t GCodeParser::param_ulong(const uint8_t ind) {
+    if (param_places[ind] & VALUE_SATURATED) return UINT32_MAX;
+    const uint8_t places = VALUE_PLACES(ind);
+    uint32_t u = param_digits[ind];
+    if (places) u /= pgm_read_dword(&pow10_long[places]);
+    return (param_places[ind] & VALUE_NEGATIVE) ? 0UL - u : u;
+  }
+
+#endif // FASTER_GCODE_VALUES
+
 #if ENABLED(GCODE_QUOTED_STRINGS)
 
   // Pass the address after the first quote (if any)
@@ -49,6 +49,8 @@
  *  - FASTER_GCODE_PARSER:
  *    - Flags existing params (1 bit each)
  *    - Stores value offsets (1 byte each)
+ *  - FASTER_GCODE_VALUES:
+ *    - Converts param values once, while parsing (5 bytes each)
  *  - Provide accessors for parameters:
  *    - Parameter exists
  *    - Parameter has value
@@ -62,6 +64,11 @@ private:
   #if ENABLED(FASTER_GCODE_PARSER)
     static uint32_t codebits;       // Parameters pre-scanned
     static uint8_t param[26];       // For A-Z, offsets into command args
+    #if ENABLED(FASTER_GCODE_VALUES)
+      static uint32_t param_digits[26]; // For A-Z, value digits without the decimal point
+      static uint8_t param_places[26];  // For A-Z, decimal places in digits, plus the sign bit
+      static uint8_t value_ind;         // Set by seen, used to fetch the converted value
+    #endif
   #else
     static char *command_args;      // Args start here, for slow scan
   #endif
@@ -120,12 +127,22 @@ public:
       return NUMERIC(p[0]) || ((p[0] == '-' || p[0] == '+') && NUMERIC(p[1])); // [-+]?[0-9]
     }
 
+    #if ENABLED(FASTER_GCODE_VALUES)
+      // Convert a parameter value to digits and decimal places
+      static void set_value(const uint8_t ind, const char *p);
+      // Get a converted parameter value
+      static float param_float(const uint8_t ind);
+      static int32_t param_long(const uint8_t ind);
+      static uint32_t param_ulong(const uint8_t ind);
+    #endif
+
     // Set the flag and pointer for a parameter
     static inline void set(const char c, char * const ptr) {
       const uint8_t ind = LETTER_BIT(c);
       if (ind >= COUNT(param)) return;           // Only A-Z
       SBI32(codebits, ind);                      // parameter exists
       param[ind] = ptr ? ptr - command_ptr : 0;  // parameter offset or 0
+      TERN_(FASTER_GCODE_VALUES, if (ptr) set_value(ind, ptr)); // parameter value, converted once
       #if ENABLED(DEBUG_GCODE_PARSER)
         if (codenum == 800) {
           SERIAL_ECHOPAIR("Set bit ", (int)ind, " of codebits (", hex_address((void*)(codebits >> 16)));
@@ -144,6 +161,7 @@ public:
       if (b) {
         char * const ptr = command_ptr + param[ind];
         value_ptr = param[ind] && valid_float(ptr) ? ptr : nullptr;
+        TERN_(FASTER_GCODE_VALUES, value_ind = ind);
       }
       return b;
     }
@@ -246,27 +264,36 @@ public:
 
   // Float removes 'E' to prevent scientific notation interpretation
   static inline float value_float() {
-    if (value_ptr) {
-      char *e = value_ptr;
-      for (;;) {
-        const char c = *e;
-        if (c == '\0' || c == ' ') break;
-        if (c == 'E' || c == 'e') {
-          *e = '\0';
-          const float ret = strtof(value_ptr, nullptr);
-          *e = c;
-          return ret;
+    #if ENABLED(FASTER_GCODE_VALUES)
+      return value_ptr ? param_float(value_ind) : 0;
+    #else
+      if (value_ptr) {
+        char *e = value_ptr;
+        for (;;) {
+          const char c = *e;
+          if (c == '\0' || c == ' ') break;
+          if (c == 'E' || c == 'e') {
+            *e = '\0';
+            const float ret = strtof(value_ptr, nullptr);
+            *e = c;
+            return ret;
+          }
+          ++e;
         }
-        ++e;
+        return strtof(value_ptr, nullptr);
       }
-      return strtof(value_ptr, nullptr);
-    }
-    return 0;
+      return 0;
+    #endif
   }
 
   // Code value as a long or ulong
-  static inline int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static inline uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #if ENABLED(FASTER_GCODE_VALUES)
+    static inline int32_t value_long() { return value_ptr ? param_long(value_ind) : 0L; }
+    static inline uint32_t value_ulong() { return value_ptr ? param_ulong(value_ind) : 0UL; }
+  #else
+    static inline int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
+    static inline uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #endif
 
   // Code value for use as time
   static inline millis_t value_millis() { return value_ulong(); }
@@ -67,7 +67,13 @@ uint8_t GCodeQueue::length = 0,  // Count of commands in the queue
         GCodeQueue::index_r = 0, // Ring buffer read position
         GCodeQueue::index_w = 0; // Ring buffer write position
 
-char GCodeQueue::command_buffer[BUFSIZE][MAX_CMD_SIZE];
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  char GCodeQueue::command_bytes[COMMAND_QUEUE_BYTES];
+  uint16_t GCodeQueue::command_start[BUFSIZE],
+           GCodeQueue::bytes_w; // Byte ring write position
+#else
+  char GCodeQueue::command_buffer[BUFSIZE][MAX_CMD_SIZE];
+#endif
 
 /*
  * The port that the command was received on
@@ -108,6 +114,38 @@ bool GCodeQueue::has_commands_queued() {
   return queue.length || injected_commands_P || injected_commands[0];
 }
 
+#if ENABLED(PACKED_COMMAND_QUEUE)
+
+  /**
+   * Commands in the byte ring run from the start of the command at index_r
+   * up to bytes_w. Each command needs MAX_CMD_SIZE contiguous bytes while it
+   * is written, so a command that won't fit at the end goes to the start.
+   * The write position never catches up to the read position, so a
+   * non-empty queue is never confused with an empty one.
+   */
+  bool GCodeQueue::has_space() {
+    uint16_t w = bytes_w;
+    if (!length)
+      w = 0;
+    else if (length >= BUFSIZE)
+      return false;
+    else {
+      const uint16_t r = command_start[index_r];
+      if (w >= r) {
+        if (w + MAX_CMD_SIZE > COMMAND_QUEUE_BYTES) {  // No room at the end?
+          if (MAX_CMD_SIZE >= r) return false;        // No room at the start?
+          w = 0;
+        }
+      }
+      else if (w + MAX_CMD_SIZE >= r)
+        return false;
+    }
+    command_start[index_w] = w;                       // Place the next command
+    return true;
+  }
+
+#endif
+
 /**
  * Clear the Marlin command queue
  */
@@ -123,6 +161,7 @@ void GCodeQueue::_commit_command(bool say_ok
     , int16_t p/*=-1*/
   #endif
 ) {
+  TERN_(PACKED_COMMAND_QUEUE, bytes_w = command_start[index_w] + strlen(command(index_w)) + 1);
   send_ok[index_w] = say_ok;
   TERN_(HAS_MULTI_SERIAL, port[index_w] = p);
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
@@ -140,8 +179,8 @@ bool GCodeQueue::_enqueue(const char* cmd, bool say_ok/*=false*/
     , int16_t pn/*=-1*/
   #endif
 ) {
-  if (*cmd == ';' || length >= BUFSIZE) return false;
-  strcpy(command_buffer[index_w], cmd);
+  if (*cmd == ';' || !has_space()) return false;
+  strcpy(command(index_w), cmd);
   _commit_command(say_ok
     #if HAS_MULTI_SERIAL
       , pn
@@ -264,6 +303,29 @@ void GCodeQueue::enqueue_now_P(PGM_P const pgcode) {
   }
 }
 
+#if ENABLED(ADVANCED_OK)
+
+  uint8_t GCodeQueue::slots_free() {
+    #if ENABLED(PACKED_COMMAND_QUEUE)
+      // Count full-length commands that are sure to fit
+      uint16_t fit;
+      if (!length)
+        fit = COMMAND_QUEUE_BYTES / (MAX_CMD_SIZE);
+      else {
+        const uint16_t r = command_start[index_r];
+        if (bytes_w >= r)
+          fit = (COMMAND_QUEUE_BYTES - bytes_w) / (MAX_CMD_SIZE) + (r ? (r - 1) / (MAX_CMD_SIZE) : 0);
+        else
+          fit = (r - 1 - bytes_w) / (MAX_CMD_SIZE);
+      }
+      return _MIN(fit, uint16_t(BUFSIZE - length));
+    #else
+      return BUFSIZE - length;
+    #endif
+  }
+
+#endif
+
 /**
  * Send an "ok" message to the host, indicating
  * that a command was successfully processed.
@@ -282,7 +344,7 @@ void GCodeQueue::ok_to_send() {
   if (!send_ok[index_r]) return;
   SERIAL_ECHOPGM(STR_OK);
   #if ENABLED(ADVANCED_OK)
-    char* p = command_buffer[index_r];
+    char* p = command(index_r);
     if (*p == 'N') {
       SERIAL_ECHO(' ');
       SERIAL_ECHO(*p++);
@@ -290,7 +352,7 @@ void GCodeQueue::ok_to_send() {
         SERIAL_ECHO(*p++);
     }
     SERIAL_ECHOPAIR_P(SP_P_STR, int(planner.moves_free()),
-                      SP_B_STR, int(BUFSIZE - length));
+                      SP_B_STR, int(slots_free()));
   #endif
   SERIAL_EOL();
 }
@@ -346,7 +408,7 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
 #define PS_PAREN  3
 #define PS_ESC    4
 
-inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline void process_stream_char(const char c, uint8_t &sis, char * const buff, int &ind) {
 
   if (sis == PS_EOL) return;    // EOL comment or overflow
 
@@ -402,7 +464,7 @@ inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD
  * Handle a line being completed. For an empty line
  * keep sensor readings going and watchdog alive.
  */
-inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline bool process_line_done(uint8_t &sis, char * const buff, int &ind) {
   sis = PS_NORMAL;
   buff[ind] = 0;
   if (ind) { ind = 0; return false; }
@@ -446,7 +508,7 @@ void GCodeQueue::get_serial_commands() {
   /**
    * Loop while serial characters are incoming and the queue is not full
    */
-  while (length < BUFSIZE && serial_data_available()) {
+  while (has_space() && serial_data_available()) {
     LOOP_L_N(i, NUM_SERIAL) {
 
       const int c = read_serial(i);
@@ -562,31 +624,64 @@ void GCodeQueue::get_serial_commands() {
     if (!IS_SD_PRINTING()) return;
 
     int sd_count = 0;
-    bool card_eof = card.eof();
-    while (length < BUFSIZE && !card_eof) {
-      const int16_t n = card.get();
-      card_eof = card.eof();
-      if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
-
-      const char sd_char = (char)n;
-      const bool is_eol = ISEOL(sd_char);
-      if (is_eol || card_eof) {
-
-        // Reset stream state, terminate the buffer, and commit a non-empty command
-        if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
-        if (!process_line_done(sd_input_state, command_buffer[index_w], sd_count)) {
-          _commit_command(false);
-          #if ENABLED(POWER_LOSS_RECOVERY)
-            recovery.cmd_sdpos = card.getIndex();     // Prime for the NEXT _commit_command
-          #endif
+
+    // Reset stream state, terminate the buffer, and commit a non-empty command.
+    // A last line with no newline is already complete: get() reports end of
+    // file only on the read after the last byte.
+    auto sd_line_done = [&]{
+      if (!process_line_done(sd_input_state, command(index_w), sd_count)) {
+        _commit_command(false);
+        #if ENABLED(POWER_LOSS_RECOVERY)
+          recovery.cmd_sdpos = card.getIndex();       // Prime for the NEXT _commit_command
+        #endif
+      }
+    };
+
+    #if ENABLED(SD_READ_AHEAD)
+
+      // Take whole runs of bytes from the read-ahead buffer, up to the next EOL
+      while (has_space() && !card.eof()) {
+        const char *data;
+        const uint16_t avail = card.buffered(data);
+        if (!avail) {
+          if (!card.eof()) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
+          sd_line_done();
+          card.fileHasFinished();                     // Handle end of file reached
+          break;
         }
 
-        if (card_eof) card.fileHasFinished();         // Handle end of file reached
+        uint16_t len = 0;
+        while (len < avail && !ISEOL(data[len]))
+          process_stream_char(data[len++], sd_input_state, command(index_w), sd_count);
+
+        if (len < avail) {
+          card.consume(len + 1);                      // Up to and including the EOL
+          sd_line_done();
+        }
+        else
+          card.consume(len);
       }
-      else
-        process_stream_char(sd_char, sd_input_state, command_buffer[index_w], sd_count);
 
-    }
+    #else
+
+      bool card_eof = card.eof();
+      while (has_space() && !card_eof) {
+        const int16_t n = card.get();
+        card_eof = card.eof();
+        if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
+
+        const char sd_char = (char)n;
+        const bool is_eol = ISEOL(sd_char);
+        if (is_eol || card_eof) {
+          sd_line_done();
+          if (card_eof) card.fileHasFinished();       // Handle end of file reached
+        }
+        else
+          process_stream_char(sd_char, sd_input_state, command(index_w), sd_count);
+
+      }
+
+    #endif
   }
 
 #endif // SDSUPPORT
@@ -618,7 +713,7 @@ void GCodeQueue::advance() {
   #if ENABLED(SDSUPPORT)
 
     if (card.flag.saving) {
-      char* command = command_buffer[index_r];
+      char* command = GCodeQueue::command(index_r);
       if (is_M29(command)) {
         // M29 closes the file
         card.closefile();
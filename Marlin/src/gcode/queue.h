@@ -50,7 +50,14 @@ public:
   static uint8_t length,  // Count of commands in the queue
                  index_r; // Ring buffer read position
 
-  static char command_buffer[BUFSIZE][MAX_CMD_SIZE];
+  #if ENABLED(PACKED_COMMAND_QUEUE)
+    static char command_bytes[COMMAND_QUEUE_BYTES];  // Commands packed end to end
+    static uint16_t command_start[BUFSIZE];          // Offset of each command in command_bytes
+    FORCE_INLINE static char* command(const uint8_t i) { return &command_bytes[command_start[i]]; }
+  #else
+    static char command_buffer[BUFSIZE][MAX_CMD_SIZE];
+    FORCE_INLINE static char* command(const uint8_t i) { return command_buffer[i]; }
+  #endif
 
   /**
    * The port that the command was received on
@@ -117,6 +124,16 @@ public:
    */
   static bool has_commands_queued();
 
+  /**
+   * Check for room to add one more command of up to MAX_CMD_SIZE.
+   * With PACKED_COMMAND_QUEUE this also places the next command.
+   */
+  #if ENABLED(PACKED_COMMAND_QUEUE)
+    static bool has_space();
+  #else
+    static inline bool has_space() { return length < BUFSIZE; }
+  #endif
+
   /**
    * Get the next command in the queue, optionally log it to SD, then dispatch it
    */
@@ -151,6 +168,15 @@ private:
 
   static uint8_t index_w;  // Ring buffer write position
 
+  #if ENABLED(PACKED_COMMAND_QUEUE)
+    static uint16_t bytes_w; // Byte ring write position
+  #endif
+
+  #if ENABLED(ADVANCED_OK)
+    // Free command slots to report to the host
+    static uint8_t slots_free();
+  #endif
+
   static void get_serial_commands();
 
   #if ENABLED(SDSUPPORT)
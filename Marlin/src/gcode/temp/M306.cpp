@@ -0,0 +1,81 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MPCTEMP)
+
+#include "../gcode.h"
+#include "../../lcd/ultralcd.h"
+#include "../../module/temperature.h"
+
+/**
+ * M306: Set (or report) Model Predictive Control constants, or tune them
+ *
+ *  E<hotend>   Hotend to set, report or tune. (Default: E0)
+ *  S<bool>     Use MPC for the hotend, instead of PID or bang-bang
+ *  P<watts>    Heater power
+ *  C<joules/kelvin>      Block heat capacity
+ *  R<kelvin/second/kelvin>  Sensor responsiveness
+ *  A<watts/kelvin>       Ambient heat transfer coefficient with the fan off
+ *  F<watts/kelvin>       Ambient heat transfer coefficient with the fan on full
+ *  H<joules/kelvin/mm>   Filament heat capacity per mm
+ *
+ *  T           Measure the constants of the hotend. Takes several minutes.
+ *
+ * Examples: M306 E0 P40 C16.7 R0.22 A0.068 F0.097 H0.0056
+ *           M306 E1 S0
+ *           M306 T E0
+ */
+void GcodeSuite::M306() {
+  const uint8_t e = parser.byteval('E');
+  if (e >= HOTENDS) {
+    SERIAL_ERROR_MSG(STR_INVALID_EXTRUDER);
+    return;
+  }
+
+  if (parser.seen('T')) {
+    #if DISABLED(BUSY_WHILE_HEATING)
+      KEEPALIVE_STATE(NOT_BUSY);
+    #endif
+    ui.set_status(GET_TEXT(MSG_MPC_AUTOTUNE));
+    thermalManager.MPC_autotune(e);
+    ui.reset_status();
+    return;
+  }
+
+  if (parser.seen("SPCRAFH")) {
+    MPC_t &mpc = thermalManager.temp_hotend[e].mpc;
+    if (parser.seen('S')) mpc.enabled = parser.value_bool();
+    if (parser.seenval('P')) mpc.heater_power = parser.value_float();
+    if (parser.seenval('C')) mpc.block_heat_capacity = parser.value_float();
+    if (parser.seenval('R')) mpc.sensor_responsiveness = parser.value_float();
+    if (parser.seenval('A')) mpc.ambient_xfer_coeff_fan0 = parser.value_float();
+    if (parser.seenval('F')) mpc.fan255_adjustment = parser.value_float() - mpc.ambient_xfer_coeff_fan0;
+    if (parser.seenval('H')) mpc.filament_heat_capacity_permm = parser.value_float();
+    thermalManager.resetMPC(e);
+  }
+  else
+    thermalManager.log_mpc(e);
+}
+
+#endif // MPCTEMP
@@ -716,6 +716,30 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "LIGHTWEIGHT_UI requires a U8GLIB_ST7920-based display."
 #endif
 
+/**
+ * SD Read-Ahead
+ */
+#if ENABLED(SD_READ_AHEAD)
+  #if DISABLED(SDSUPPORT)
+    #error "SD_READ_AHEAD requires SDSUPPORT."
+  #elif !defined(SD_READ_AHEAD_SIZE) || SD_READ_AHEAD_SIZE < 512 || SD_READ_AHEAD_SIZE % 512
+    #error "SD_READ_AHEAD_SIZE must be a multiple of 512."
+  #elif SD_READ_AHEAD_SIZE > 16384
+    #error "SD_READ_AHEAD_SIZE must be 16384 or smaller."
+  #endif
+#endif
+
+/**
+ * SD Block Cache
+ */
+#if ENABLED(SD_BLOCK_CACHE)
+  #if DISABLED(SDSUPPORT)
+    #error "SD_BLOCK_CACHE requires SDSUPPORT."
+  #elif !WITHIN(SD_CACHE_FAT_LINES, 1, 16) || !WITHIN(SD_CACHE_DATA_LINES, 1, 16)
+    #error "SD_CACHE_FAT_LINES and SD_CACHE_DATA_LINES must be from 1 to 16."
+  #endif
+#endif
+
 /**
  * SD File Sorting
  */
@@ -1013,6 +1037,51 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+/**
+ * Per-axis Step Timing requirements
+ */
+#if ENABLED(PER_AXIS_STEP_TIMING)
+  #ifdef __AVR__
+    #error "PER_AXIS_STEP_TIMING requires a 32-bit board."
+  #elif ENABLED(ADAPTIVE_STEP_SMOOTHING)
+    #error "PER_AXIS_STEP_TIMING and ADAPTIVE_STEP_SMOOTHING are not compatible. Enable only one."
+  #elif ENABLED(I2S_STEPPER_STREAM)
+    #error "PER_AXIS_STEP_TIMING is not compatible with I2S_STEPPER_STREAM."
+  #endif
+#endif
+
+/**
+ * Step Interval Table requirements
+ */
+#if ENABLED(STEP_INTERVAL_TABLE)
+  #ifdef __AVR__
+    #error "STEP_INTERVAL_TABLE requires a 32-bit board."
+  #elif ENABLED(ADAPTIVE_STEP_SMOOTHING)
+    #error "STEP_INTERVAL_TABLE is not compatible with ADAPTIVE_STEP_SMOOTHING."
+  #elif ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+    #error "STEP_INTERVAL_TABLE is not compatible with LASER_POWER_INLINE_TRAPEZOID."
+  #elif !WITHIN(STEP_INTERVAL_TABLE_SIZE, 1, 127)
+    #error "STEP_INTERVAL_TABLE_SIZE must be from 1 to 127."
+  #endif
+#endif
+
+/**
+ * Arc Block requirements
+ */
+#if ENABLED(ARC_BLOCKS)
+  #ifdef __AVR__
+    #error "ARC_BLOCKS requires a 32-bit board."
+  #elif DISABLED(ARC_SUPPORT)
+    #error "ARC_BLOCKS requires ARC_SUPPORT."
+  #elif IS_KINEMATIC || EITHER(IS_CORE, MARKFORGED_XY)
+    #error "ARC_BLOCKS requires Cartesian X and Y axes."
+  #elif ENABLED(SKEW_CORRECTION)
+    #error "ARC_BLOCKS is not compatible with SKEW_CORRECTION."
+  #elif ENABLED(BACKLASH_COMPENSATION)
+    #error "ARC_BLOCKS is not compatible with BACKLASH_COMPENSATION."
+  #endif
+#endif
+
 /**
  * Special tool-changing options
  */
@@ -1144,6 +1213,13 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "To use BED_LIMIT_SWITCHING you must disable PIDTEMPBED."
 #endif
 
+/**
+ * Hotend Model Predictive Control
+ */
+#if ENABLED(MPCTEMP) && !HAS_HOTEND
+  #error "MPCTEMP requires at least one hotend."
+#endif
+
 /**
  * Kinematics
  */
@@ -1176,6 +1252,10 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "DELTA_AUTO_CALIBRATION requires a probe or LCD Controller."
   #elif ENABLED(DELTA_CALIBRATION_MENU) && !HAS_LCD_MENU
     #error "DELTA_CALIBRATION_MENU requires an LCD Controller."
+  #elif defined(DELTA_SEGMENT_BATCH) && !WITHIN(DELTA_SEGMENT_BATCH, 2, 64)
+    #error "DELTA_SEGMENT_BATCH must be from 2 to 64."
+  #elif defined(DELTA_SEGMENT_BATCH) && ENABLED(SKEW_CORRECTION)
+    #error "DELTA_SEGMENT_BATCH is not compatible with SKEW_CORRECTION."
   #elif ABL_GRID
     #if (GRID_MAX_POINTS_X & 1) == 0 || (GRID_MAX_POINTS_Y & 1) == 0
       #error "DELTA requires GRID_MAX_POINTS_X and GRID_MAX_POINTS_Y to be odd numbers."
@@ -1183,6 +1263,11 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
       #error "DELTA requires GRID_MAX_POINTS_X and GRID_MAX_POINTS_Y to be 3 or higher."
     #endif
   #endif
+  #ifdef DELTA_SEGMENT_TOLERANCE
+    static_assert(DELTA_SEGMENT_TOLERANCE > 0, "DELTA_SEGMENT_TOLERANCE must be greater than 0.");
+  #endif
+#elif defined(DELTA_SEGMENT_BATCH)
+  #error "DELTA_SEGMENT_BATCH requires DELTA."
 #endif
 
 /**
@@ -1443,6 +1528,17 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
 
 #endif
 
+#ifdef LEVELED_SEGMENT_TOLERANCE
+  #if IS_KINEMATIC
+    #error "LEVELED_SEGMENT_TOLERANCE is only for Cartesian machines. Use DELTA_SEGMENT_TOLERANCE for DELTA."
+  #elif !HAS_MESH
+    #error "LEVELED_SEGMENT_TOLERANCE requires MESH_BED_LEVELING, AUTO_BED_LEVELING_BILINEAR, or AUTO_BED_LEVELING_UBL."
+  #elif DISABLED(AUTO_BED_LEVELING_UBL) && DISABLED(SEGMENT_LEVELED_MOVES)
+    #error "LEVELED_SEGMENT_TOLERANCE requires SEGMENT_LEVELED_MOVES (or AUTO_BED_LEVELING_UBL)."
+  #endif
+  static_assert(LEVELED_SEGMENT_TOLERANCE > 0, "LEVELED_SEGMENT_TOLERANCE must be greater than 0.");
+#endif
+
 #if HAS_MESH && HAS_CLASSIC_JERK
   static_assert(DEFAULT_ZJERK > 0.1, "Low DEFAULT_ZJERK values are incompatible with mesh-based leveling.");
 #endif
@@ -2132,7 +2228,19 @@ static_assert(hbm[Z_AXIS] >= 0, "HOMING_BUMP_MM.Z must be greater than or equal
     #error "NEOPIXEL2_SEPARATE requires NEOPIXEL2_TYPE, NEOPIXEL2_PIN and NEOPIXEL2_PIXELS."
   #elif ENABLED(NEO2_COLOR_PRESETS) && DISABLED(NEOPIXEL2_SEPARATE)
     #error "NEO2_COLOR_PRESETS requires NEOPIXEL2_SEPARATE to be enabled."
+  #elif ENABLED(NEOPIXEL_DEFERRED_SHOW) && !(defined(NEOPIXEL_FRAME_MS) && defined(NEOPIXEL_MIN_PLANNED_BLOCKS))
+    #error "NEOPIXEL_DEFERRED_SHOW requires NEOPIXEL_FRAME_MS and NEOPIXEL_MIN_PLANNED_BLOCKS."
+  #elif ENABLED(NEOPIXEL_EFFECTS) && DISABLED(NEOPIXEL_DEFERRED_SHOW)
+    #error "NEOPIXEL_EFFECTS requires NEOPIXEL_DEFERRED_SHOW."
+  #elif ENABLED(NEOPIXEL_EFFECTS) && !(defined(NEOPIXEL_EFFECTS_FRAME_MS) && NEOPIXEL_BREATHE_MS >= 2)
+    #error "NEOPIXEL_EFFECTS requires NEOPIXEL_EFFECTS_FRAME_MS and NEOPIXEL_BREATHE_MS."
   #endif
+#elif EITHER(NEOPIXEL_DEFERRED_SHOW, NEOPIXEL_EFFECTS)
+  #error "NEOPIXEL_DEFERRED_SHOW and NEOPIXEL_EFFECTS require NEOPIXEL_LED."
+#endif
+
+#if ENABLED(BINARY_NEOPIXEL_TRANSFER) && !BOTH(BINARY_FILE_TRANSFER, NEOPIXEL_LED)
+  #error "BINARY_NEOPIXEL_TRANSFER requires BINARY_FILE_TRANSFER and NEOPIXEL_LED."
 #endif
 
 #if DISABLED(NO_COMPILE_TIME_PWM)
@@ -2733,6 +2841,10 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #endif
 #endif
 
+#if ENABLED(EEPROM_JOURNAL) && !defined(__PLAT_LINUX__)
+  #error "EEPROM_JOURNAL is currently only supported on LINUX."
+#endif
+
 #if ENABLED(PRINTCOUNTER) && DISABLED(EEPROM_SETTINGS)
   #error "PRINTCOUNTER requires EEPROM_SETTINGS. Please update your Configuration."
 #endif
@@ -2749,6 +2861,14 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "GCODE_MACROS_SLOTS must be a number from 1 to 10."
 #endif
 
+#if ENABLED(PACKED_COMMAND_QUEUE) && !WITHIN(COMMAND_QUEUE_BYTES, 2 * (MAX_CMD_SIZE), 65535)
+  #error "COMMAND_QUEUE_BYTES must be from 2 * MAX_CMD_SIZE to 65535."
+#endif
+
+#if ENABLED(FASTER_GCODE_VALUES) && DISABLED(FASTER_GCODE_PARSER)
+  #error "FASTER_GCODE_VALUES requires FASTER_GCODE_PARSER."
+#endif
+
 #if ENABLED(CUSTOM_USER_MENUS)
   #ifdef USER_GCODE_1
     constexpr char _chr1 = USER_GCODE_1[strlen(USER_GCODE_1) - 1];
@@ -139,6 +139,68 @@ void inverse_kinematics(const xyz_pos_t &raw) {
   #endif
 }
 
+#ifdef DELTA_SEGMENT_BATCH
+
+  void inverse_kinematics_line(abc_float_t rise[], const xy_pos_t &raw, const xy_float_t &step, const uint8_t count) {
+    #if HAS_HOTEND_OFFSET
+      const xy_pos_t pos = { raw.x - hotend_offset[active_extruder].x, raw.y - hotend_offset[active_extruder].y };
+    #else
+      const xy_pos_t &pos = raw;
+    #endif
+
+    // rod^2 - |tower - pos - i * step|^2 gains 2(w.step) - (2i+1)|step|^2 from point i to point i+1
+    const float step_2 = HYPOT2(step.x, step.y);
+    LOOP_ABC(t) {
+      const xy_float_t w = delta_tower[t] - pos;
+      float r = delta_diagonal_rod_2_tower[t] - HYPOT2(w.x, w.y),
+            d = 2 * (w.x * step.x + w.y * step.y) - step_2;
+      LOOP_L_N(i, count) {
+        r += d;
+        d -= 2 * step_2;
+        rise[i][t] = SQRT(r);
+      }
+    }
+  }
+
+#endif
+
+#ifdef DELTA_SEGMENT_TOLERANCE
+
+  /**
+   * A carriage sits sqrt(R) above the effector, where R = rod^2 - |v|^2 and
+   * v runs from the effector to the tower. Along a line in XY its height
+   * bends by (rod^2 - p^2) / R^(3/2) per mm^2, with p the distance from the
+   * tower to the line. R is smallest at one end of the line, so the ends
+   * bound the bend, and a chord of length L strays from the curve by at
+   * most bend * L^2 / 8.
+   */
+  uint16_t delta_segments_needed(const xy_pos_t &start, const xy_pos_t &end) {
+    const xy_float_t dist = end - start;
+    const float xy_mm = dist.magnitude();
+    if (UNEAR_ZERO(xy_mm)) return 1;
+    const xy_float_t unit = dist * RECIPROCAL(xy_mm);
+
+    #if HAS_HOTEND_OFFSET
+      const xy_pos_t pos = { start.x - hotend_offset[active_extruder].x, start.y - hotend_offset[active_extruder].y };
+    #else
+      const xy_pos_t &pos = start;
+    #endif
+
+    float bend = 0;
+    LOOP_ABC(t) {
+      const xy_float_t w = delta_tower[t] - pos;
+      const float r = _MIN(delta_diagonal_rod_2_tower[t] - HYPOT2(w.x, w.y),
+                           delta_diagonal_rod_2_tower[t] - HYPOT2(w.x - dist.x, w.y - dist.y)),
+                  p = w.x * unit.y - w.y * unit.x;
+      NOLESS(bend, (delta_diagonal_rod_2_tower[t] - sq(p)) / (r * SQRT(r)));
+    }
+
+    const float segments = CEIL(xy_mm * SQRT(bend * (0.125f / (DELTA_SEGMENT_TOLERANCE))));
+    return segments < 65535.0f ? _MAX(1, uint16_t(segments)) : 65535;
+  }
+
+#endif
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
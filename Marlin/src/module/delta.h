@@ -89,6 +89,28 @@ void recalc_delta_settings();
 
 void inverse_kinematics(const xyz_pos_t &raw);
 
+#ifdef DELTA_SEGMENT_BATCH
+  /**
+   * Delta Inverse Kinematics for evenly spaced points on a line
+   *
+   * Get the height of each carriage above the effector at 'count'
+   * points, each 'step' beyond the last, starting one step past 'raw'.
+   * Add the effector Z to get the tower positions.
+   *
+   * Along a line the term under each root is a quadratic in the point
+   * index, so it's stepped by finite differences with two additions.
+   */
+  void inverse_kinematics_line(abc_float_t rise[], const xy_pos_t &raw, const xy_float_t &step, const uint8_t count);
+#endif
+
+#ifdef DELTA_SEGMENT_TOLERANCE
+  /**
+   * Get the number of straight tower-space segments needed to keep every
+   * carriage within DELTA_SEGMENT_TOLERANCE of its path for a line in XY.
+   */
+  uint16_t delta_segments_needed(const xy_pos_t &start, const xy_pos_t &end);
+#endif
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
@@ -769,6 +769,19 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
       NOMORE(segments, cartesian_mm * RECIPROCAL(SCARA_MIN_SEGMENT_LENGTH));
     #endif
 
+    // For DELTA use no more segments than the path needs
+    #ifdef DELTA_SEGMENT_TOLERANCE
+      const uint16_t max_segments = segments;
+      NOMORE(segments, delta_segments_needed(current_position, destination));
+      #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+        // ...but keep leveled segments short enough to follow the mesh
+        if (planner.leveling_active) {
+          const float leveled_mm = TERN(SEGMENT_LEVELED_MOVES, LEVELED_SEGMENT_LENGTH, _MIN(bilinear_grid_spacing.x, bilinear_grid_spacing.y));
+          NOLESS(segments, _MIN(max_segments, uint16_t(CEIL(HYPOT(diff.x, diff.y) / leveled_mm))));
+        }
+      #endif
+    #endif
+
     // At least one segment is required
     NOLESS(segments, 1U);
 
@@ -794,15 +807,27 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
 
     // Calculate and execute the segments
     millis_t next_idle_ms = millis() + 200UL;
-    while (--segments) {
-      segment_idle(next_idle_ms);
-      raw += segment_distance;
-      if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, cartesian_segment_mm
-        #if ENABLED(SCARA_FEEDRATE_SCALING)
-          , inv_duration
-        #endif
-      )) break;
-    }
+    #ifdef DELTA_SEGMENT_BATCH
+      // Get the tower heights for a batch of segments, then queue them all
+      abc_float_t rise[DELTA_SEGMENT_BATCH];
+      for (uint16_t left = segments - 1; left;) {
+        segment_idle(next_idle_ms);
+        const uint8_t count = _MIN(left, uint16_t(DELTA_SEGMENT_BATCH));
+        inverse_kinematics_line(rise, raw, segment_distance, count);
+        if (!planner.buffer_line_segments(raw, segment_distance, rise, count, scaled_fr_mm_s, active_extruder, cartesian_segment_mm)) break;
+        left -= count;
+      }
+    #else
+      while (--segments) {
+        segment_idle(next_idle_ms);
+        raw += segment_distance;
+        if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, cartesian_segment_mm
+          #if ENABLED(SCARA_FEEDRATE_SCALING)
+            , inv_duration
+          #endif
+        )) break;
+      }
+    #endif
 
     // Ensure last segment arrives at target location.
     planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, cartesian_segment_mm
@@ -816,7 +841,136 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
 
 #else // !IS_KINEMATIC
 
-  #if ENABLED(SEGMENT_LEVELED_MOVES)
+  #if ENABLED(SEGMENT_LEVELED_MOVES) && defined(LEVELED_SEGMENT_TOLERANCE)
+
+    // Get the leveling correction at a fraction of the way along the move
+    inline float leveling_offset_along(const xyze_float_t &diff, const float t) {
+      xyze_pos_t pos = current_position + diff * t;
+      const float z = pos.z;
+      planner.apply_leveling(pos);
+      return pos.z - z;
+    }
+
+    // Mesh lines, where the leveling correction can bend
+    #if ENABLED(MESH_BED_LEVELING)
+      #define LEVELING_LINE_START(A) MESH_MIN_##A
+      #define LEVELING_LINE_SPACING(A) MESH_##A##_DIST
+      #define LEVELING_LINES(A) GRID_MAX_POINTS_##A
+    #else
+      #define LEVELING_LINE_START(A) bilinear_start[_AXIS(A)]
+      #define LEVELING_LINE_SPACING(A) (bilinear_grid_spacing[_AXIS(A)] / TERN(ABL_BILINEAR_SUBDIVISION, BILINEAR_SUBDIVISIONS, 1))
+      #define LEVELING_LINES(A) ((GRID_MAX_POINTS_##A - 1) * TERN(ABL_BILINEAR_SUBDIVISION, BILINEAR_SUBDIVISIONS, 1) + 1)
+    #endif
+
+    // Get the fraction of the move where it next crosses a mesh line, after t
+    inline float next_leveling_line(const float &from, const float &dist, const float &start, const float &spacing, const int16_t lines, const float t) {
+      if (!dist) return INFINITY;
+      const float k = (from + dist * t - start) / spacing;
+      int16_t kn;
+      if (dist > 0) {
+        kn = FLOOR(k + 0.001f) + 1;             // Skip a line the move is on
+        if (kn >= lines) return INFINITY;
+        NOLESS(kn, 0);
+      }
+      else {
+        kn = CEIL(k - 0.001f) - 1;
+        if (kn < 0) return INFINITY;
+        NOMORE(kn, lines - 1);
+      }
+      return (start + kn * spacing - from) / dist;
+    }
+
+    // Get the largest |e| on a parabola through e(0), e(1/2), and e(1)
+    inline float parabola_peak(const float &e0, const float &em, const float &e1) {
+      float peak = _MAX(ABS(e0), ABS(em), ABS(e1));
+      const float a = 2 * (e0 - 2 * em + e1), b = e1 - e0 - a;
+      if (a) {
+        const float s = -b / (2 * a);
+        if (s > 0 && s < 1) NOLESS(peak, ABS(e0 - sq(b) / (4 * a)));
+      }
+      return peak;
+    }
+
+    /**
+     * Check that leveling a segment only at its ends keeps it within LEVELED_SEGMENT_TOLERANCE
+     * of the mesh. Between the mesh lines the segment crosses, the correction is a parabola
+     * (bilinear) so the largest deviation of each piece follows from its ends and middle.
+     */
+    inline bool segment_follows_mesh(const xyze_float_t &diff, const float t0, const float z0, const float t1, const float z1) {
+      const float slope = (z1 - z0) / (t1 - t0);
+      #define _DEVIATION(T) (leveling_offset_along(diff, T) - (z0 + slope * ((T) - t0)))
+      float a = t0, ea = 0;
+      while (a < t1) {
+        const float b = _MIN(t1,
+                          next_leveling_line(current_position.x, diff.x, LEVELING_LINE_START(X), LEVELING_LINE_SPACING(X), LEVELING_LINES(X), a),
+                          next_leveling_line(current_position.y, diff.y, LEVELING_LINE_START(Y), LEVELING_LINE_SPACING(Y), LEVELING_LINES(Y), a)
+                        );
+        const float eb = b < t1 ? _DEVIATION(b) : 0;
+        if (parabola_peak(ea, _DEVIATION((a + b) * 0.5f), eb) > (LEVELED_SEGMENT_TOLERANCE)) return false;
+        a = b;
+        ea = eb;
+      }
+      return true;
+    }
+
+    /**
+     * Prepare a segmented move on a CARTESIAN setup.
+     *
+     * The planner levels each segment at its ends, so Z follows a straight line
+     * in between. Try the rest of the move as one segment and halve it until it
+     * follows the mesh within LEVELED_SEGMENT_TOLERANCE, or it is down to
+     * LEVELED_SEGMENT_LENGTH.
+     */
+    inline void segmented_line_to_destination(const feedRate_t &fr_mm_s) {
+
+      const xyze_float_t diff = destination - current_position;
+
+      // If the move is only in Z/E don't split up the move
+      if (!diff.x && !diff.y) {
+        planner.buffer_line(destination, fr_mm_s, active_extruder);
+        return;
+      }
+
+      // Get the linear distance in XYZ
+      // If the move is very short, check the E move distance
+      // No E move either? Game over.
+      float cartesian_mm = diff.magnitude();
+      if (UNEAR_ZERO(cartesian_mm)) cartesian_mm = ABS(diff.e);
+      if (UNEAR_ZERO(cartesian_mm)) return;
+
+      // The shortest segment as a fraction of the move
+      const float min_part = (LEVELED_SEGMENT_LENGTH) / cartesian_mm;
+
+      // Calculate and execute the segments
+      millis_t next_idle_ms = millis() + 200UL;
+      float t0 = 0, z0 = leveling_offset_along(diff, 0);
+      while (t0 < 1) {
+        segment_idle(next_idle_ms);
+
+        float t1 = 1, z1 = leveling_offset_along(diff, 1);
+        while (t1 - t0 > min_part && !segment_follows_mesh(diff, t0, z0, t1, z1)) {
+          // Halve, but never below LEVELED_SEGMENT_LENGTH, nor leave a shorter piece at the end
+          const float half = (t1 - t0) * 0.5f;
+          const bool shortest = half <= min_part;
+          t1 = !shortest ? t0 + half : t0 + min_part * 2 < 1 ? t0 + min_part : 1;
+          z1 = leveling_offset_along(diff, t1);
+          if (shortest) break;
+        }
+
+        // The last segment must be to the exact destination
+        const float segment_mm = cartesian_mm * (t1 - t0);
+        if (t1 < 1) {
+          if (!planner.buffer_line(current_position + diff * t1, fr_mm_s, active_extruder, segment_mm)) break;
+        }
+        else
+          planner.buffer_line(destination, fr_mm_s, active_extruder, segment_mm);
+
+        t0 = t1;
+        z0 = z1;
+      }
+    }
+
+  #elif ENABLED(SEGMENT_LEVELED_MOVES)
 
     /**
      * Prepare a segmented move on a CARTESIAN setup.
@@ -766,6 +766,41 @@ block_t* Planner::get_current_block() {
   return nullptr;
 }
 
+#if ENABLED(PLANNER_FIXED_POINT)
+
+  // Integer square root, rounded down
+  static uint32_t isqrt(uint64_t x) {
+    if (!(x >> 32)) { // The usual case, and much cheaper on 32-bit MCUs
+      uint32_t x32 = x, r = 0, bit = 1UL << 30;
+      while (bit > x32) bit >>= 2;
+      for (; bit; bit >>= 2) {
+        if (x32 >= r + bit) { x32 -= r + bit; r = (r >> 1) + bit; }
+        else r >>= 1;
+      }
+      return r;
+    }
+    uint64_t r = 0, bit = 1ULL << 62;
+    while (bit > x) bit >>= 2;
+    for (; bit; bit >>= 2) {
+      if (x >= r + bit) { x -= r + bit; r = (r >> 1) + bit; }
+      else r >>= 1;
+    }
+    return r;
+  }
+
+  // Integer square root, rounded up
+  static inline uint32_t isqrt_ceil(const uint64_t x) {
+    const uint32_t r = isqrt(x);
+    return uint64_t(r) * r < x ? r + 1 : r;
+  }
+
+  uint32_t Planner::speed_sqr_to_rate(const block_t * const block, const float &speed_sqr) {
+    const uint32_t rate = isqrt_ceil(uint64_t(CEIL(speed_sqr * block->rate_sqr_factor)));
+    return _MIN(rate, block->nominal_rate);
+  }
+
+#endif
+
 /**
  * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
  * by the provided factors.
@@ -776,6 +811,118 @@ block_t* Planner::get_current_block() {
  * is not and will not use the block while we modify it, so it is safe to
  * alter its values.
  */
+#if ENABLED(PLANNER_FIXED_POINT)
+
+/**
+ * With PLANNER_FIXED_POINT the entry and exit step rates are given and the
+ * trapezoid is worked out in integer math. It follows the float version
+ * below step for step, rounding the same way.
+ */
+void Planner::calculate_trapezoid_for_block(block_t* const block, const uint32_t entry_rate, const uint32_t exit_rate) {
+
+  // Limit minimal step rate (Otherwise the timer will overflow.)
+  const uint32_t initial_rate = _MAX(entry_rate, uint32_t(MINIMAL_STEP_RATE)),
+                 final_rate = _MAX(exit_rate, uint32_t(MINIMAL_STEP_RATE));
+
+  #if ENABLED(S_CURVE_ACCELERATION)
+    uint32_t cruise_rate = initial_rate;
+  #endif
+
+  const uint32_t accel = block->acceleration_steps_per_s2;
+  const int64_t accel_x2 = int64_t(accel) * 2,
+                nominal_sqr = int64_t(sq(uint64_t(block->nominal_rate))),
+                initial_sqr = int64_t(sq(uint64_t(initial_rate))),
+                final_sqr = int64_t(sq(uint64_t(final_rate)));
+
+          // Steps required for acceleration, deceleration to/from nominal rate
+  uint32_t accelerate_steps = 0, decelerate_steps = 0;
+  if (accel) {
+    if (nominal_sqr > initial_sqr) accelerate_steps = (nominal_sqr - initial_sqr + accel_x2 - 1) / accel_x2;
+    if (nominal_sqr > final_sqr) decelerate_steps = (nominal_sqr - final_sqr) / accel_x2;
+  }
+          // Steps between acceleration and deceleration, if any
+  int32_t plateau_steps = block->step_event_count - accelerate_steps - decelerate_steps;
+
+  // Does accelerate_steps + decelerate_steps exceed step_event_count?
+  // Then we can't possibly reach the nominal rate, there will be no cruising.
+  // Find the intersection point to reach the final_rate exactly at the end of this block.
+  if (plateau_steps < 0) {
+    const int64_t dist = accel_x2 * block->step_event_count - initial_sqr + final_sqr;
+    accelerate_steps = dist > 0 ? _MIN(uint32_t((dist + accel_x2 * 2 - 1) / (accel_x2 * 2)), block->step_event_count) : 0;
+    plateau_steps = 0;
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+      // We won't reach the cruising rate. Let's calculate the speed we will reach
+      cruise_rate = isqrt(initial_sqr + accel_x2 * accelerate_steps);
+    #endif
+  }
+  #if ENABLED(S_CURVE_ACCELERATION)
+    else // We have some plateau time, so the cruise rate will be the nominal rate
+      cruise_rate = block->nominal_rate;
+  #endif
+
+  #if ENABLED(S_CURVE_ACCELERATION)
+    // Jerk controlled speed requires to express speed versus time, NOT steps
+    uint32_t acceleration_time = accel ? uint64_t(cruise_rate - initial_rate) * (STEPPER_TIMER_RATE) / accel : 0,
+             deceleration_time = accel ? uint64_t(cruise_rate - final_rate) * (STEPPER_TIMER_RATE) / accel : 0,
+    // And to offload calculations from the ISR, we also calculate the inverse of those times here
+             acceleration_time_inverse = get_period_inverse(acceleration_time),
+             deceleration_time_inverse = get_period_inverse(deceleration_time);
+  #endif
+
+  // Store new block parameters
+  block->accelerate_until = accelerate_steps;
+  block->decelerate_after = accelerate_steps + plateau_steps;
+  block->initial_rate = initial_rate;
+  #if ENABLED(S_CURVE_ACCELERATION)
+    block->acceleration_time = acceleration_time;
+    block->deceleration_time = deceleration_time;
+    block->acceleration_time_inverse = acceleration_time_inverse;
+    block->deceleration_time_inverse = deceleration_time_inverse;
+    block->cruise_rate = cruise_rate;
+  #endif
+  block->final_rate = final_rate;
+
+  // The stepper ISR's intervals on the ramps
+  TERN_(STEP_INTERVAL_TABLE, stepper.calc_step_intervals(block));
+
+  // Laser trapezoid calculations, as below
+  #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+    if (block->laser.power > 0) { // No need to care if power == 0
+      const uint8_t entry_power = uint32_t(block->laser.power) * entry_rate / block->nominal_rate; // Power on block entry
+      #if DISABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
+        // Speedup power
+        const uint8_t entry_power_diff = block->laser.power - entry_power;
+        if (entry_power_diff) {
+          block->laser.entry_per = accelerate_steps / entry_power_diff;
+          block->laser.power_entry = entry_power;
+        }
+        else {
+          block->laser.entry_per = 0;
+          block->laser.power_entry = block->laser.power;
+        }
+        // Slowdown power
+        const uint8_t exit_power = uint32_t(block->laser.power) * exit_rate / block->nominal_rate, // Power on block exit
+                      exit_power_diff = block->laser.power - exit_power;
+        if (exit_power_diff) {
+          block->laser.exit_per = (block->step_event_count - block->decelerate_after) / exit_power_diff;
+          block->laser.power_exit = exit_power;
+        }
+        else {
+          block->laser.exit_per = 0;
+          block->laser.power_exit = block->laser.power;
+        }
+      #else
+        block->laser.power_entry = entry_power;
+      #endif
+    }
+  #endif
+}
+
+#endif // PLANNER_FIXED_POINT
+
+#if DISABLED(PLANNER_FIXED_POINT) || defined(__PLAT_LINUX__)
+
 void Planner::calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor) {
 
   uint32_t initial_rate = CEIL(block->nominal_rate * entry_factor),
@@ -838,6 +985,9 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
   #endif
   block->final_rate = final_rate;
 
+  // The stepper ISR's intervals on the ramps
+  TERN_(STEP_INTERVAL_TABLE, stepper.calc_step_intervals(block));
+
   /**
    * Laser trapezoid calculations
    *
@@ -880,6 +1030,78 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
   #endif
 }
 
+#endif // !PLANNER_FIXED_POINT || __PLAT_LINUX__
+
+#if ENABLED(PLANNER_FIXED_POINT) && defined(__PLAT_LINUX__)
+
+  #include <stdio.h>
+
+  bool Planner::check_trapezoids() {
+    static const uint32_t step_counts[] = { 1, 2, 3, 10, 57, 400, 3200, 25000, 160000 },
+                          nominal_rates[] = { 120, 900, 5000, 24000, 80000 },
+                          accels[] = { 800, 8000, 40000, 200000 };
+    static const float steps_per_mm[] = { 80, 400, 4000 },
+                       speed_factors[] = { 0, 0.05f, 0.3f, 0.5f, 0.77f, 0.99f, 1 };
+
+    uint32_t blocks = 0, mismatches = 0, rate_diff = 0, step_diff = 0;
+    block_t fixed, flt;
+    for (const uint32_t steps : step_counts) for (const uint32_t rate : nominal_rates)
+    for (const uint32_t accel : accels) for (const float spmm : steps_per_mm) {
+      memset(&flt, 0, sizeof(flt));
+      flt.step_event_count = steps;
+      flt.nominal_rate = rate;
+      flt.acceleration_steps_per_s2 = accel;
+      const float nominal_speed = rate / spmm;
+      flt.nominal_speed_sqr = sq(nominal_speed);
+      flt.rate_sqr_factor = sq(float(rate)) / flt.nominal_speed_sqr;
+      fixed = flt;
+
+      for (const float entry : speed_factors) for (const float exit : speed_factors) {
+        const float entry_speed_sqr = sq(entry * nominal_speed), exit_speed_sqr = sq(exit * nominal_speed);
+
+        // Float rates and trapezoid, as recalculate_trapezoids() does it without PLANNER_FIXED_POINT
+        const float nomr = 1.0f / SQRT(flt.nominal_speed_sqr);
+        calculate_trapezoid_for_block(&flt, SQRT(entry_speed_sqr) * nomr, SQRT(exit_speed_sqr) * nomr);
+
+        // Integer rates from the same speeds
+        const uint32_t entry_rate = _MAX(speed_sqr_to_rate(&fixed, entry_speed_sqr), uint32_t(MINIMAL_STEP_RATE)),
+                       exit_rate = _MAX(speed_sqr_to_rate(&fixed, exit_speed_sqr), uint32_t(MINIMAL_STEP_RATE));
+
+        // Integer trapezoid from the float rates, so a rate rounded the other way can't move the ramps
+        calculate_trapezoid_for_block(&fixed, flt.initial_rate, flt.final_rate);
+
+        #define _DIFF(A,B) uint32_t(ABS(int64_t(A) - int64_t(B)))
+        const uint32_t rd = _MAX(_DIFF(entry_rate, flt.initial_rate), _DIFF(exit_rate, flt.final_rate)),
+                       sd = _MAX(_DIFF(fixed.accelerate_until, flt.accelerate_until), _DIFF(fixed.decelerate_after, flt.decelerate_after));
+
+        #if ENABLED(S_CURVE_ACCELERATION)
+          // The cruise rate may differ by one more step of acceleration
+          const bool cruise_ok = _DIFF(fixed.cruise_rate, flt.cruise_rate) <= 1 + accel / fixed.cruise_rate;
+        #else
+          constexpr bool cruise_ok = true;
+        #endif
+        #undef _DIFF
+
+        NOLESS(rate_diff, rd);
+        NOLESS(step_diff, sd);
+        if (rd > 1 || sd > 1 || !cruise_ok) {
+          if (mismatches++ < 20)
+            fprintf(stderr, "Mismatch: steps=%u nominal_rate=%u accel=%u steps/mm=%g entry=%g exit=%g"
+                            " rates %u/%u %u/%u accelerate_until %u/%u decelerate_after %u/%u cruise_ok=%d\n",
+              steps, rate, accel, spmm, entry, exit, entry_rate, flt.initial_rate, exit_rate, flt.final_rate,
+              fixed.accelerate_until, flt.accelerate_until, fixed.decelerate_after, flt.decelerate_after, cruise_ok);
+        }
+        blocks++;
+      }
+    }
+
+    fprintf(stderr, "Trapezoids: %u blocks, largest difference %u steps/s and %u steps, %u mismatches\n",
+      blocks, rate_diff, step_diff, mismatches);
+    return !mismatches;
+  }
+
+#endif
+
 /*                            PLANNER SPEED DEFINITION
                                      +--------+   <- current->nominal_speed
                                     /          \
@@ -943,7 +1165,8 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
 */
 
 // The kernel called by recalculate() when scanning the plan from last to first entry.
-void Planner::reverse_pass_kernel(block_t* const current, const block_t * const next) {
+// Returns true if the entry speed of the current block was changed.
+bool Planner::reverse_pass_kernel(block_t* const current, const block_t * const next) {
   if (current) {
     // If entry speed is already at the maximum entry speed, and there was no change of speed
     // in the next block, there is no need to recheck. Block is cruising and there is no need to
@@ -984,17 +1207,26 @@ void Planner::reverse_pass_kernel(block_t* const current, const block_t * const
           // Block is not BUSY so this is ahead of the Stepper ISR:
           // Just Set the new entry speed.
           current->entry_speed_sqr = new_entry_speed_sqr;
+          return true;
         }
       }
     }
   }
+  return false;
 }
 
 /**
  * recalculate() needs to go over the current plan twice.
  * Once in reverse and once forward. This implements the reverse pass.
+ *
+ * Every block between the planned pointer and the head was left with its
+ * reverse-planned entry speed by the previous pass, so once a block's entry
+ * speed comes out unchanged, all the blocks before it will too. The pass
+ * stops there and returns that block as the place to start the forward pass.
+ * That doesn't apply to the newest block, since the block before it was
+ * planned to come to a stop and has to be looked at anyway.
  */
-void Planner::reverse_pass() {
+uint8_t Planner::reverse_pass() {
   // Initialize block index to the last block in the planner buffer.
   uint8_t block_index = prev_block_index(block_buffer_head);
 
@@ -1005,7 +1237,7 @@ void Planner::reverse_pass() {
   // If there was a race condition and block_buffer_planned was incremented
   //  or was pointing at the head (queue empty) break loop now and avoid
   //  planning already consumed blocks
-  if (planned_block_index == block_buffer_head) return;
+  if (planned_block_index == block_buffer_head) return planned_block_index;
 
   // Reverse Pass: Coarsely maximize all possible deceleration curves back-planning from the last
   // block in buffer. Cease planning when the last optimal planned or tail pointer is reached.
@@ -1018,7 +1250,7 @@ void Planner::reverse_pass() {
 
     // Only consider non sync and page blocks
     if (!TEST(current->flag, BLOCK_BIT_SYNC_POSITION) && !IS_PAGE(current)) {
-      reverse_pass_kernel(current, next);
+      if (!reverse_pass_kernel(current, next) && next) return block_index;
       next = current;
     }
 
@@ -1031,12 +1263,13 @@ void Planner::reverse_pass() {
     while (planned_block_index != block_buffer_planned) {
 
       // If we reached the busy block or an already processed block, break the loop now
-      if (block_index == planned_block_index) return;
+      if (block_index == planned_block_index) return planned_block_index;
 
       // Advance the pointer, following the busy block
       planned_block_index = next_block_index(planned_block_index);
     }
   }
+  return planned_block_index;
 }
 
 // The kernel called by recalculate() when scanning the plan from first to last entry.
@@ -1093,16 +1326,16 @@ void Planner::forward_pass_kernel(const block_t* const previous, block_t* const
  * recalculate() needs to go over the current plan twice.
  * Once in reverse and once forward. This implements the forward pass.
  */
-void Planner::forward_pass() {
+void Planner::forward_pass(uint8_t block_index) {
 
-  // Forward Pass: Forward plan the acceleration curve from the planned pointer onward.
-  // Also scans for optimal plan breakpoints and appropriately updates the planned pointer.
+  // Forward Pass: Forward plan the acceleration curve from the first block the reverse
+  // pass may have changed (at the latest the planned pointer) onward. Also scans for
+  // optimal plan breakpoints and appropriately updates the planned pointer.
 
-  // Begin at buffer planned pointer. Note that block_buffer_planned can be modified
-  //  by the stepper ISR,  so read it ONCE. It it guaranteed that block_buffer_planned
-  //  will never lead head, so the loop is safe to execute. Also note that the forward
-  //  pass will never modify the values at the tail.
-  uint8_t block_index = block_buffer_planned;
+  // Note that block_buffer_planned can be modified by the stepper ISR, so the reverse
+  //  pass reads it ONCE. It it guaranteed that block_buffer_planned will never lead head,
+  //  so the loop is safe to execute. Also note that the forward pass will never modify
+  //  the values at the tail.
 
   block_t *block;
   const block_t * previous = nullptr;
@@ -1155,15 +1388,15 @@ void Planner::recalculate_trapezoids() {
   }
 
   // Go from the tail (currently executed block) to the first block, without including it)
+  // Only blocks touched by the reverse and forward passes are flagged, so the speeds
+  // are only worked out for those. Most of a long buffer is just stepped over.
   block_t *block = nullptr, *next = nullptr;
-  float current_entry_speed = 0.0, next_entry_speed = 0.0;
   while (block_index != head_block_index) {
 
     next = &block_buffer[block_index];
 
     // Skip sync and page blocks
     if (!TEST(next->flag, BLOCK_BIT_SYNC_POSITION) && !IS_PAGE(next)) {
-      next_entry_speed = SQRT(next->entry_speed_sqr);
 
       if (block) {
         // Recalculate if current block entry or exit junction speed has changed.
@@ -1180,16 +1413,29 @@ void Planner::recalculate_trapezoids() {
           if (!stepper.is_block_busy(block)) {
             // Block is not BUSY, we won the race against the Stepper ISR:
 
-            // NOTE: Entry and exit factors always > 0 by all previous logic operations.
-            const float current_nominal_speed = SQRT(block->nominal_speed_sqr),
-                        nomr = 1.0f / current_nominal_speed;
-            calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
-            #if ENABLED(LIN_ADVANCE)
-              if (block->use_advance_lead) {
-                const float comp = block->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
-                block->max_adv_steps = current_nominal_speed * comp;
-                block->final_adv_steps = next_entry_speed * comp;
-              }
+            #if ENABLED(PLANNER_FIXED_POINT)
+              calculate_trapezoid_for_block(block, speed_sqr_to_rate(block, block->entry_speed_sqr), speed_sqr_to_rate(block, next->entry_speed_sqr));
+              #if ENABLED(LIN_ADVANCE)
+                if (block->use_advance_lead) {
+                  const float comp = block->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
+                  block->max_adv_steps = SQRT(block->nominal_speed_sqr) * comp;
+                  block->final_adv_steps = SQRT(next->entry_speed_sqr) * comp;
+                }
+              #endif
+            #else
+              // NOTE: Entry and exit factors always > 0 by all previous logic operations.
+              const float current_entry_speed = SQRT(block->entry_speed_sqr),
+                          next_entry_speed = SQRT(next->entry_speed_sqr),
+                          current_nominal_speed = SQRT(block->nominal_speed_sqr),
+                          nomr = 1.0f / current_nominal_speed;
+              calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
+              #if ENABLED(LIN_ADVANCE)
+                if (block->use_advance_lead) {
+                  const float comp = block->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
+                  block->max_adv_steps = current_nominal_speed * comp;
+                  block->final_adv_steps = next_entry_speed * comp;
+                }
+              #endif
             #endif
           }
 
@@ -1200,7 +1446,6 @@ void Planner::recalculate_trapezoids() {
       }
 
       block = next;
-      current_entry_speed = next_entry_speed;
     }
 
     block_index = next_block_index(block_index);
@@ -1220,15 +1465,28 @@ void Planner::recalculate_trapezoids() {
     if (!stepper.is_block_busy(block)) {
       // Block is not BUSY, we won the race against the Stepper ISR:
 
-      const float next_nominal_speed = SQRT(next->nominal_speed_sqr),
-                  nomr = 1.0f / next_nominal_speed;
-      calculate_trapezoid_for_block(next, next_entry_speed * nomr, float(MINIMUM_PLANNER_SPEED) * nomr);
-      #if ENABLED(LIN_ADVANCE)
-        if (next->use_advance_lead) {
-          const float comp = next->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
-          next->max_adv_steps = next_nominal_speed * comp;
-          next->final_adv_steps = (MINIMUM_PLANNER_SPEED) * comp;
-        }
+      // The entry speed of the newest block that isn't a sync or page block
+      #if ENABLED(PLANNER_FIXED_POINT)
+        calculate_trapezoid_for_block(next, block ? speed_sqr_to_rate(next, block->entry_speed_sqr) : 0, speed_sqr_to_rate(next, sq(float(MINIMUM_PLANNER_SPEED))));
+        #if ENABLED(LIN_ADVANCE)
+          if (next->use_advance_lead) {
+            const float comp = next->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
+            next->max_adv_steps = SQRT(next->nominal_speed_sqr) * comp;
+            next->final_adv_steps = (MINIMUM_PLANNER_SPEED) * comp;
+          }
+        #endif
+      #else
+        const float next_entry_speed = block ? SQRT(block->entry_speed_sqr) : 0.0f,
+                    next_nominal_speed = SQRT(next->nominal_speed_sqr),
+                    nomr = 1.0f / next_nominal_speed;
+        calculate_trapezoid_for_block(next, next_entry_speed * nomr, float(MINIMUM_PLANNER_SPEED) * nomr);
+        #if ENABLED(LIN_ADVANCE)
+          if (next->use_advance_lead) {
+            const float comp = next->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
+            next->max_adv_steps = next_nominal_speed * comp;
+            next->final_adv_steps = (MINIMUM_PLANNER_SPEED) * comp;
+          }
+        #endif
       #endif
     }
 
@@ -1242,13 +1500,28 @@ void Planner::recalculate() {
   // Initialize block index to the last block in the planner buffer.
   const uint8_t block_index = prev_block_index(block_buffer_head);
   // If there is just one block, no planning can be done. Avoid it!
-  if (block_index != block_buffer_planned) {
-    reverse_pass();
-    forward_pass();
-  }
+  if (block_index != block_buffer_planned)
+    forward_pass(reverse_pass());
   recalculate_trapezoids();
 }
 
+#if ENABLED(MPCTEMP)
+
+  float Planner::queued_extrusion_speed(const uint8_t extruder, const float &horizon) {
+    float e_mm = 0, duration = 0;
+    for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
+      const block_t * const block = &block_buffer[b];
+      if (!block->step_event_count) continue; // Sync blocks take no time
+      if (block->extruder == extruder && !TEST(block->direction_bits, E_AXIS))
+        e_mm += block->steps.e * steps_to_mm[E_AXIS_N(extruder)];
+      duration += float(block->step_event_count) / block->nominal_rate;
+      if (duration >= horizon) break;
+    }
+    return duration ? e_mm / duration : 0;
+  }
+
+#endif
+
 #if ENABLED(AUTOTEMP)
 
   void Planner::getHighESpeed() {
@@ -1663,6 +1936,9 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
  * Block until all buffered steps are executed / cleaned
  */
 void Planner::synchronize() {
+  #ifdef HAL_PLANNER_BENCH_SYNC
+    HAL_PLANNER_BENCH_SYNC(); // Emptying the buffer here is not an underrun
+  #endif
   while (has_blocks_queued() || cleaning_buffer_counter
       || TERN0(EXTERNAL_CLOSED_LOOP_CONTROLLER, CLOSED_LOOP_WAITING())
   ) idle();
@@ -1689,6 +1965,9 @@ bool Planner::_buffer_steps(const xyze_long_t &target
     , const xyze_float_t &cart_dist_mm
   #endif
   , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters
+  #if ENABLED(ARC_BLOCKS)
+    , const block_arc_t * const arc
+  #endif
 ) {
 
   // If we are cleaning, do not accept queuing of movements
@@ -1698,6 +1977,10 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   uint8_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
 
+  #ifdef HAL_PLANNER_BENCH_BEGIN
+    HAL_PLANNER_BENCH_BEGIN(); // Let the HAL time the planning of this block
+  #endif
+
   // Fill the block with the specified movement
   if (!_populate_block(block, false, target
     #if HAS_POSITION_FLOAT
@@ -1707,7 +1990,13 @@ bool Planner::_buffer_steps(const xyze_long_t &target
       , cart_dist_mm
     #endif
     , fr_mm_s, extruder, millimeters
+    #if ENABLED(ARC_BLOCKS)
+      , arc
+    #endif
   )) {
+    #ifdef HAL_PLANNER_BENCH_END
+      HAL_PLANNER_BENCH_END(false);
+    #endif
     // Movement was not queued, probably because it was too short.
     //  Simply accept that as movement queued and done
     return true;
@@ -1729,10 +2018,23 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   // Recalculate and optimize trapezoidal speed profiles
   recalculate();
 
+  #ifdef HAL_PLANNER_BENCH_END
+    HAL_PLANNER_BENCH_END(true);
+  #endif
+
   // Movement successfully queued!
   return true;
 }
 
+#if ENABLED(ARC_BLOCKS)
+  // Turn the XY part of a vector from the start of an arc to its end
+  FORCE_INLINE void arc_turn_xy(xyze_float_t &v, const xy_float_t &turn) {
+    const float x = v.x;
+    v.x = x * turn.x - v.y * turn.y;
+    v.y = x * turn.y + v.y * turn.x;
+  }
+#endif
+
 /**
  * Planner::_populate_block
  *
@@ -1741,6 +2043,7 @@ bool Planner::_buffer_steps(const xyze_long_t &target
  *  target      - target position in steps units
  *  fr_mm_s     - (target) speed of the move
  *  extruder    - target extruder
+ *  arc         - arc for the stepper to run as chords, if any
  *
  * Returns true if movement is acceptable, false otherwise
  */
@@ -1753,6 +2056,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     , const xyze_float_t &cart_dist_mm
   #endif
   , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters/*=0.0*/
+  #if ENABLED(ARC_BLOCKS)
+    , const block_arc_t * const arc/*=nullptr*/
+  #endif
 ) {
 
   const int32_t da = target.a - position.a,
@@ -1925,6 +2231,23 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     steps_dist_mm.c = dc * steps_to_mm[C_AXIS];
   #endif
 
+  #if ENABLED(ARC_BLOCKS)
+    xy_float_t arc_entry{0}, arc_turn{0};   // Unit tangent at the start, and the rotation to the end
+    float arc_radius = 0;
+    if (arc) {
+      // X and Y could each move the whole length of the arc
+      arc_radius = arc->center.magnitude();
+      const float turn = arc->theta * arc->chords,
+                  flat_mm = arc_radius * ABS(turn);
+      arc_entry.set(arc->center.y, -arc->center.x);
+      arc_entry *= (turn < 0 ? -1.0f : 1.0f) / arc_radius;
+      arc_turn.set(cos(turn), sin(turn));
+      steps_dist_mm.a = steps_dist_mm.b = flat_mm;
+      block->steps.a = CEIL(flat_mm * settings.axis_steps_per_mm[A_AXIS]);
+      block->steps.b = CEIL(flat_mm * settings.axis_steps_per_mm[B_AXIS]);
+    }
+  #endif
+
   #if EXTRUDERS
     steps_dist_mm.e = esteps_float * steps_to_mm[E_AXIS_N(extruder)];
   #else
@@ -1974,6 +2297,26 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
   block->step_event_count = _MAX(block->steps.a, block->steps.b, block->steps.c, esteps);
 
+  #if ENABLED(ARC_BLOCKS)
+    if (arc) {
+      // Give every chord the same number of step events, with room for
+      // rounding and for a target that lies a little off the circle
+      const xy_float_t circle_end = {
+        arc->center.x - arc->center.x * arc_turn.x + arc->center.y * arc_turn.y,
+        arc->center.y - arc->center.x * arc_turn.y - arc->center.y * arc_turn.x
+      };
+      const float miss = _MAX(ABS(da - circle_end.x * settings.axis_steps_per_mm[A_AXIS]),
+                              ABS(db - circle_end.y * settings.axis_steps_per_mm[B_AXIS]));
+      const uint32_t xy_events = CEIL(float(_MAX(block->steps.a, block->steps.b)) / arc->chords + miss) + 2,
+                     ze_events = CEIL(float(_MAX(block->steps.c, esteps)) / arc->chords);
+      block->arc = *arc;
+      block->arc.chord_events = _MAX(xy_events, ze_events);
+      block->arc.end.set(da, db);
+      block->step_event_count = block->arc.chord_events * arc->chords;
+      block->flag |= BLOCK_FLAG_IS_ARC;
+    }
+  #endif
+
   // Bail if this is a zero-length block
   if (block->step_event_count < MIN_STEPS_PER_SEGMENT) return false;
 
@@ -2212,6 +2555,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     block->nominal_speed_sqr = block->nominal_speed_sqr * sq(speed_factor);
   }
 
+  // The one divide that lets recalculate_trapezoids() turn speeds into step rates without float SQRT
+  TERN_(PLANNER_FIXED_POINT, block->rate_sqr_factor = sq(float(block->nominal_rate)) / block->nominal_speed_sqr);
+
   // Compute and limit the acceleration rate for the trapezoid generator.
   const float steps_per_mm = block->step_event_count * inverse_millimeters;
   uint32_t accel;
@@ -2261,9 +2607,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
           #if IS_KINEMATIC
             block->millimeters
           #else
-            SQRT(sq(target_float.x - position_float.x)
-               + sq(target_float.y - position_float.y)
-               + sq(target_float.z - position_float.z))
+            (TERN0(ARC_BLOCKS, arc) ? block->millimeters : SQRT(sq(target_float.x - position_float.x)
+                                                                + sq(target_float.y - position_float.y)
+                                                                + sq(target_float.z - position_float.z)))
           #endif
         ;
 
@@ -2296,6 +2642,25 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   }
   block->acceleration_steps_per_s2 = accel;
   block->acceleration = accel / steps_per_mm;
+
+  #if ENABLED(ARC_BLOCKS)
+    if (arc) {
+      // Keep the centripetal acceleration within the block acceleration
+      const float arc_speed_sqr = block->acceleration * arc_radius;
+      if (block->nominal_speed_sqr > arc_speed_sqr) {
+        const float factor = SQRT(arc_speed_sqr / block->nominal_speed_sqr);
+        block->nominal_rate = CEIL(block->nominal_rate * factor);
+        block->nominal_speed_sqr = arc_speed_sqr;
+        current_speed *= factor;
+        TERN_(PLANNER_FIXED_POINT, block->rate_sqr_factor = sq(float(block->nominal_rate)) / block->nominal_speed_sqr);
+      }
+      // Enter the arc along its tangent
+      const float xy_speed = current_speed.x;
+      current_speed.x = arc_entry.x * xy_speed;
+      current_speed.y = arc_entry.y * xy_speed;
+    }
+  #endif
+
   #if DISABLED(S_CURVE_ACCELERATION)
     block->acceleration_rate = (uint32_t)(accel * (4096.0f * 4096.0f / (STEPPER_TIMER_RATE)));
   #endif
@@ -2359,6 +2724,14 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
       #endif
     ;
 
+    #if ENABLED(ARC_BLOCKS)
+      // An arc starts out along its tangent
+      if (arc) {
+        unit_vec.x = arc_entry.x * steps_dist_mm.a;
+        unit_vec.y = arc_entry.y * steps_dist_mm.a;
+      }
+    #endif
+
     /**
      * On CoreXY the length of the vector [A,B] is SQRT(2) times the length of the head movement vector [X,Y].
      * So taking Z and E into account, we cannot scale to a unit vector with "inverse_millimeters".
@@ -2491,6 +2864,11 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
     prev_unit_vec = unit_vec;
 
+    #if ENABLED(ARC_BLOCKS)
+      // ...and leaves along the tangent at its end
+      if (arc) arc_turn_xy(prev_unit_vec, arc_turn);
+    #endif
+
   #endif
 
   #ifdef USE_CACHED_SQRT
@@ -2624,6 +3002,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
   // Update previous path unit_vector and nominal speed
   previous_speed = current_speed;
+  #if ENABLED(ARC_BLOCKS)
+    if (arc) arc_turn_xy(previous_speed, arc_turn);
+  #endif
   previous_nominal_speed_sqr = block->nominal_speed_sqr;
 
   position = target;  // Update the position
@@ -2686,6 +3067,9 @@ bool Planner::buffer_segment(const float &a, const float &b, const float &c, con
     , const xyze_float_t &cart_dist_mm
   #endif
   , const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters/*=0.0*/
+  #if ENABLED(ARC_BLOCKS)
+    , const block_arc_t * const arc/*=nullptr*/
+  #endif
 ) {
 
   // If we are cleaning, do not accept queuing of movements
@@ -2757,7 +3141,11 @@ bool Planner::buffer_segment(const float &a, const float &b, const float &c, con
       #if HAS_DIST_MM_ARG
         , cart_dist_mm
       #endif
-      , fr_mm_s, extruder, millimeters)
+      , fr_mm_s, extruder, millimeters
+      #if ENABLED(ARC_BLOCKS)
+        , arc
+      #endif
+    )
   ) return false;
 
   stepper.wake_up();
@@ -2826,6 +3214,64 @@ bool Planner::buffer_line(const float &rx, const float &ry, const float &rz, con
   #endif
 } // buffer_line()
 
+#ifdef DELTA_SEGMENT_BATCH
+
+  bool Planner::buffer_line_segments(xyze_pos_t &raw, const xyze_float_t &step, const abc_float_t rise[], const uint8_t count,
+                                     const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters
+  ) {
+    LOOP_L_N(i, count) {
+      const xyze_pos_t cart = raw + step;
+      xyze_pos_t machine = cart;
+      TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
+
+      // Each tower sits at the effector Z plus its carriage's rise
+      if (!buffer_segment(machine.z + rise[i].a, machine.z + rise[i].b, machine.z + rise[i].c, machine.e
+        #if HAS_DIST_MM_ARG
+          , step
+        #endif
+        , fr_mm_s, extruder, millimeters
+      )) return false;
+
+      raw = position_cart = cart;
+    }
+    return true;
+  }
+
+#endif
+
+#if ENABLED(ARC_BLOCKS)
+
+  /**
+   * Add an arc in the XY plane to the buffer as a single block.
+   * The stepper turns the radius vector by one chord at a time,
+   * so leveling must be off and the arc must stay within bounds.
+   *
+   *  cart           - target position in mm
+   *  offset         - center of the arc relative to the current position
+   *  angular_travel - angle of the arc (radians, CCW positive)
+   *  chords         - number of chords to step the arc as
+   *  fr_mm_s        - (target) speed of the move (mm/s)
+   *  extruder       - target extruder
+   *  millimeters    - the length of the arc, including any helical travel
+   */
+  bool Planner::buffer_arc(const xyze_pos_t &cart, const ab_float_t &offset, const float &angular_travel,
+    const uint16_t chords, const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters
+  ) {
+    xyze_pos_t machine = cart;
+    TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
+
+    block_arc_t arc;
+    arc.center = offset;
+    arc.theta = angular_travel / chords;
+    arc.cos_t = cos(arc.theta);
+    arc.sin_t = sin(arc.theta);
+    arc.chords = chords;
+
+    return buffer_segment(machine.x, machine.y, machine.z, machine.e, fr_mm_s, extruder, millimeters, &arc);
+  } // buffer_arc()
+
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
 
   void Planner::buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps) {
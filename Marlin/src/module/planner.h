@@ -73,6 +73,12 @@
   #define IS_PAGE(B) false
 #endif
 
+#if ENABLED(ARC_BLOCKS)
+  #define IS_ARC(B) TEST(B->flag, BLOCK_BIT_IS_ARC)
+#else
+  #define IS_ARC(B) false
+#endif
+
 // Feedrate for manual moves
 #ifdef MANUAL_FEEDRATE
   constexpr xyze_feedrate_t _mf = MANUAL_FEEDRATE,
@@ -102,6 +108,11 @@ enum BlockFlagBit : char {
   #if ENABLED(DIRECT_STEPPING)
     , BLOCK_BIT_IS_PAGE
   #endif
+
+  // Arc in the XY plane, stepped as chords
+  #if ENABLED(ARC_BLOCKS)
+    , BLOCK_BIT_IS_ARC
+  #endif
 };
 
 enum BlockFlag : char {
@@ -112,6 +123,9 @@ enum BlockFlag : char {
   #if ENABLED(DIRECT_STEPPING)
     , BLOCK_FLAG_IS_PAGE            = _BV(BLOCK_BIT_IS_PAGE)
   #endif
+  #if ENABLED(ARC_BLOCKS)
+    , BLOCK_FLAG_IS_ARC             = _BV(BLOCK_BIT_IS_ARC)
+  #endif
 };
 
 #if ENABLED(LASER_POWER_INLINE)
@@ -138,6 +152,19 @@ enum BlockFlag : char {
 
 #endif
 
+#if ENABLED(ARC_BLOCKS)
+
+  typedef struct {
+    xy_float_t center;        // Center of the arc relative to its start (mm)
+    float theta,              // Angle turned by each chord (radians, CCW positive)
+          cos_t, sin_t;       // Rotation of the radius vector by each chord
+    uint16_t chords;          // Number of chords the stepper runs
+    uint32_t chord_events;    // Step events in each chord
+    xy_long_t end;            // End of the arc relative to its start (steps)
+  } block_arc_t;
+
+#endif
+
 /**
  * struct block_t
  *
@@ -202,10 +229,27 @@ typedef struct block_t {
            final_rate,                      // The minimal rate at exit
            acceleration_steps_per_s2;       // acceleration steps/sec^2
 
+  #if ENABLED(STEP_INTERVAL_TABLE)
+    uint8_t accel_intervals,                // Table entries for the acceleration ramp
+            decel_intervals;                // Table entries for the deceleration ramp, following those
+    uint32_t step_intervals[2 * (STEP_INTERVAL_TABLE_SIZE)]; // Stepper ISR intervals, as (ticks << 8) | steps per ISR
+    #if DISABLED(S_CURVE_ACCELERATION)
+      uint32_t accel_end_rate;              // The step rate reached by the acceleration ramp
+    #endif
+  #endif
+
+  #if ENABLED(PLANNER_FIXED_POINT)
+    float rate_sqr_factor;                  // (nominal_rate)^2 / nominal_speed_sqr, to get (steps/sec)^2 from (mm/sec)^2
+  #endif
+
   #if ENABLED(DIRECT_STEPPING)
     page_idx_t page_idx;                    // Page index used for direct stepping
   #endif
 
+  #if ENABLED(ARC_BLOCKS)
+    block_arc_t arc;                        // Arc geometry for the stepper
+  #endif
+
   #if HAS_CUTTER
     cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
   #endif
@@ -673,6 +717,9 @@ class Planner {
         , const xyze_float_t &cart_dist_mm
       #endif
       , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters=0.0
+      #if ENABLED(ARC_BLOCKS)
+        , const block_arc_t * const arc=nullptr
+      #endif
     );
 
     /**
@@ -696,6 +743,9 @@ class Planner {
         , const xyze_float_t &cart_dist_mm
       #endif
       , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters=0.0
+      #if ENABLED(ARC_BLOCKS)
+        , const block_arc_t * const arc=nullptr
+      #endif
     );
 
     /**
@@ -728,6 +778,9 @@ class Planner {
         , const xyze_float_t &cart_dist_mm
       #endif
       , const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters=0.0
+      #if ENABLED(ARC_BLOCKS)
+        , const block_arc_t * const arc=nullptr
+      #endif
     );
 
     FORCE_INLINE static bool buffer_segment(abce_pos_t &abce
@@ -774,6 +827,43 @@ class Planner {
       );
     }
 
+    #ifdef DELTA_SEGMENT_BATCH
+      /**
+       * Add a run of equal segments along a line to the buffer.
+       * The carriage heights come from inverse_kinematics_line,
+       * so modifiers may only change Z and E.
+       *
+       *  raw         - start position in mm, advanced past each queued segment
+       *  step        - cartesian distance covered by each segment
+       *  rise        - height of each carriage above the effector at each segment's end
+       *  count       - number of segments
+       *  fr_mm_s     - (target) speed of the move (mm/s)
+       *  extruder    - target extruder
+       *  millimeters - the length of each segment
+       */
+      static bool buffer_line_segments(xyze_pos_t &raw, const xyze_float_t &step, const abc_float_t rise[], const uint8_t count,
+                                       const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters);
+    #endif
+
+    #if ENABLED(ARC_BLOCKS)
+      /**
+       * Add an arc in the XY plane to the buffer as a single block.
+       * The stepper turns it into chords, so the target must need
+       * no leveling or skew and the arc must stay within bounds.
+       *
+       *  cart         - target position in mm
+       *  offset       - center of the arc relative to the current position
+       *  angular_travel - angle of the arc (radians, CCW positive)
+       *  chords       - number of chords to step the arc as
+       *  fr_mm_s      - (target) speed of the move (mm/s)
+       *  extruder     - target extruder
+       *  millimeters  - the length of the arc, including any helical travel
+       */
+      static bool buffer_arc(const xyze_pos_t &cart, const ab_float_t &offset, const float &angular_travel,
+        const uint16_t chords, const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters
+      );
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
@@ -876,6 +966,23 @@ class Planner {
       static void clear_block_buffer_runtime();
     #endif
 
+    #if ENABLED(MPCTEMP)
+      /**
+       * The mean extrusion speed (mm/s) of an extruder over the queued moves,
+       * from the current move through at least 'horizon' seconds of moves.
+       */
+      static float queued_extrusion_speed(const uint8_t extruder, const float &horizon);
+    #endif
+
+    #if ENABLED(PLANNER_FIXED_POINT) && defined(__PLAT_LINUX__)
+      /**
+       * Plan a range of blocks with the integer and the float trapezoid math
+       * and report any rate or step count that differs by more than 1.
+       * Run by 'marlin --check-planner'. Returns false on a mismatch.
+       */
+      static bool check_trapezoids();
+    #endif
+
     #if ENABLED(AUTOTEMP)
       static float autotemp_min, autotemp_max, autotemp_factor;
       static bool autotemp_enabled;
@@ -940,13 +1047,28 @@ class Planner {
       }
     #endif
 
-    static void calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor);
+    #if ENABLED(PLANNER_FIXED_POINT)
+
+      /**
+       * The step rate, rounded up, for a speed along the block given as (mm/sec)^2.
+       * A float multiply and an integer square root, with no float divide or SQRT.
+       */
+      static uint32_t speed_sqr_to_rate(const block_t * const block, const float &speed_sqr);
+
+      static void calculate_trapezoid_for_block(block_t* const block, const uint32_t entry_rate, const uint32_t exit_rate);
+
+    #endif
+
+    // The simulator also builds the float version to check the integer one against it
+    #if DISABLED(PLANNER_FIXED_POINT) || defined(__PLAT_LINUX__)
+      static void calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor);
+    #endif
 
-    static void reverse_pass_kernel(block_t* const current, const block_t * const next);
+    static bool reverse_pass_kernel(block_t* const current, const block_t * const next);
     static void forward_pass_kernel(const block_t * const previous, block_t* const current, uint8_t block_index);
 
-    static void reverse_pass();
-    static void forward_pass();
+    static uint8_t reverse_pass();
+    static void forward_pass(uint8_t block_index);
 
     static void recalculate_trapezoids();
 
@@ -305,6 +305,13 @@ typedef struct SettingsDataStruct {
   PIDCF_t hotendPID[HOTENDS];                           // M301 En PIDCF / M303 En U
   int16_t lpq_len;                                      // M301 L
 
+  //
+  // MPCTEMP
+  //
+  #if ENABLED(MPCTEMP)
+    MPC_t mpc_constants[HOTENDS];                       // M306 En SPCRAFH / M306 T En
+  #endif
+
   //
   // PIDTEMPBED
   //
@@ -878,6 +885,14 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(TERN(PID_EXTRUSION_SCALING, thermalManager.lpq_len, lpq_len));
     }
 
+    //
+    // MPCTEMP
+    //
+    #if ENABLED(MPCTEMP)
+      _FIELD_TEST(mpc_constants);
+      HOTEND_LOOP() EEPROM_WRITE(thermalManager.temp_hotend[e].mpc);
+    #endif
+
     //
     // PIDTEMPBED
     //
@@ -1760,6 +1775,19 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(lpq_len);
       }
 
+      //
+      // Model Predictive Control
+      //
+      #if ENABLED(MPCTEMP)
+      {
+        _FIELD_TEST(mpc_constants);
+        HOTEND_LOOP() {
+          EEPROM_READ(thermalManager.temp_hotend[e].mpc);
+          if (!validating) thermalManager.resetMPC(e);
+        }
+      }
+      #endif
+
       //
       // Heated Bed PID
       //
@@ -1783,6 +1811,9 @@ void MarlinSettings::postprocess() {
       {
         _FIELD_TEST(user_thermistor);
         EEPROM_READ(thermalManager.user_thermistor);
+        #if ENABLED(THERMISTOR_LUT)
+          if (!validating) LOOP_L_N(i, USER_THERMISTORS) thermalManager.user_thermistor[i].pre_calc = true; // Refill the lookup tables
+        #endif
       }
       #endif
 
@@ -2717,6 +2748,35 @@ void MarlinSettings::reset() {
   //
   TERN_(PID_EXTRUSION_SCALING, thermalManager.lpq_len = 20); // Default last-position-queue size
 
+  //
+  // Model Predictive Control
+  //
+  #if ENABLED(MPCTEMP)
+    constexpr float mpc_heater_power[] = MPC_HEATER_POWER,
+                    mpc_block_heat_capacity[] = MPC_BLOCK_HEAT_CAPACITY,
+                    mpc_sensor_responsiveness[] = MPC_SENSOR_RESPONSIVENESS,
+                    mpc_ambient_xfer_coeff[] = MPC_AMBIENT_XFER_COEFF,
+                    mpc_ambient_xfer_coeff_fan255[] = MPC_AMBIENT_XFER_COEFF_FAN255,
+                    filament_heat_capacity_permm[] = FILAMENT_HEAT_CAPACITY_PERMM;
+    static_assert(WITHIN(COUNT(mpc_heater_power), 1, HOTENDS), "MPC_HEATER_POWER must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(mpc_block_heat_capacity), 1, HOTENDS), "MPC_BLOCK_HEAT_CAPACITY must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(mpc_sensor_responsiveness), 1, HOTENDS), "MPC_SENSOR_RESPONSIVENESS must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(mpc_ambient_xfer_coeff), 1, HOTENDS), "MPC_AMBIENT_XFER_COEFF must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(mpc_ambient_xfer_coeff_fan255), 1, HOTENDS), "MPC_AMBIENT_XFER_COEFF_FAN255 must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(filament_heat_capacity_permm), 1, HOTENDS), "FILAMENT_HEAT_CAPACITY_PERMM must have between 1 and HOTENDS items.");
+    HOTEND_LOOP() {
+      MPC_t &mpc = thermalManager.temp_hotend[e].mpc;
+      mpc.enabled = true;
+      mpc.heater_power = mpc_heater_power[ALIM(e, mpc_heater_power)];
+      mpc.block_heat_capacity = mpc_block_heat_capacity[ALIM(e, mpc_block_heat_capacity)];
+      mpc.sensor_responsiveness = mpc_sensor_responsiveness[ALIM(e, mpc_sensor_responsiveness)];
+      mpc.ambient_xfer_coeff_fan0 = mpc_ambient_xfer_coeff[ALIM(e, mpc_ambient_xfer_coeff)];
+      mpc.fan255_adjustment = mpc_ambient_xfer_coeff_fan255[ALIM(e, mpc_ambient_xfer_coeff_fan255)] - mpc.ambient_xfer_coeff_fan0;
+      mpc.filament_heat_capacity_permm = filament_heat_capacity_permm[ALIM(e, filament_heat_capacity_permm)];
+      thermalManager.resetMPC(e);
+    }
+  #endif
+
   //
   // Heated Bed PID
   //
@@ -3297,6 +3357,14 @@ void MarlinSettings::reset() {
 
     #endif // PIDTEMP || PIDTEMPBED
 
+    #if ENABLED(MPCTEMP)
+      CONFIG_ECHO_HEADING("Model predictive control:");
+      HOTEND_LOOP() {
+        CONFIG_ECHO_START();
+        thermalManager.log_mpc(e, true);
+      }
+    #endif
+
     #if HAS_USER_THERMISTORS
       CONFIG_ECHO_HEADING("User thermistors:");
       LOOP_L_N(i, USER_THERMISTORS)
@@ -209,6 +209,31 @@ uint32_t Stepper::advance_divisor = 0,
   bool Stepper::bezier_2nd_half;    // =false If Bézier curve has been initialized or not
 #endif
 
+#if ENABLED(PER_AXIS_STEP_TIMING)
+  uint32_t Stepper::nextAxisISR = AXIS_STEP_NEVER,
+           Stepper::axis_isr_time,
+           Stepper::axis_merge_ticks;
+  xyze_ulong_t Stepper::axis_step_due;
+#endif
+
+#if ENABLED(STEP_INTERVAL_TABLE)
+  uint8_t Stepper::step_table_index;
+#endif
+
+#if ENABLED(ARC_BLOCKS)
+  Stepper::arc_chord_t Stepper::arc_queue[ARC_CHORD_QUEUE];
+  uint8_t Stepper::arc_queue_tail,
+          Stepper::arc_queued;
+  xy_float_t Stepper::arc_radius;
+  xy_long_t Stepper::arc_pos;
+  uint16_t Stepper::arc_chord;
+  uint8_t Stepper::arc_direction_bits;
+  uint32_t Stepper::arc_events;
+  #if N_ARC_CORRECTION > 1
+    uint8_t Stepper::arc_correct;
+  #endif
+#endif
+
 #if ENABLED(LIN_ADVANCE)
 
   uint32_t Stepper::nextAdvanceISR = LA_ADV_NEVER,
@@ -1378,6 +1403,10 @@ void Stepper::isr() {
     // Enable ISRs to reduce USART processing latency
     ENABLE_ISRS();
 
+    #if ENABLED(PER_AXIS_STEP_TIMING)
+      if (!nextAxisISR) nextAxisISR = axis_step_isr();              // 0 = Do minor axis Stepper pulses, before any pulse phase due now
+    #endif
+
     if (!nextMainISR) pulse_phase_isr();                            // 0 = Do coordinated axes Stepper pulses
 
     #if ENABLED(LIN_ADVANCE)
@@ -1391,6 +1420,10 @@ void Stepper::isr() {
 
     // ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
+    #if ENABLED(PER_AXIS_STEP_TIMING)
+      const bool is_pulse_phase = !nextMainISR;
+    #endif
+
     if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
@@ -1401,9 +1434,16 @@ void Stepper::isr() {
         NOLESS(nextBabystepISR, nextMainISR / 2);       // TODO: Only look at axes enabled for baby-stepping
     #endif
 
+    #if ENABLED(PER_AXIS_STEP_TIMING)
+      if (is_pulse_phase) schedule_axis_steps(nextMainISR); // Place the minor axis steps before the next pulse phase
+    #endif
+
     // Get the interval to the next ISR call
     const uint32_t interval = _MIN(
       nextMainISR                                       // Time until the next Pulse / Block phase
+      #if ENABLED(PER_AXIS_STEP_TIMING)
+        , nextAxisISR                                   // Come back early for a minor axis step?
+      #endif
       #if ENABLED(LIN_ADVANCE)
         , nextAdvanceISR                                // Come back early for Linear Advance?
       #endif
@@ -1422,6 +1462,10 @@ void Stepper::isr() {
 
     nextMainISR -= interval;
 
+    #if ENABLED(PER_AXIS_STEP_TIMING)
+      if (nextAxisISR != AXIS_STEP_NEVER) nextAxisISR -= interval;
+    #endif
+
     #if ENABLED(LIN_ADVANCE)
       if (nextAdvanceISR != LA_ADV_NEVER) nextAdvanceISR -= interval;
     #endif
@@ -1487,7 +1531,12 @@ void Stepper::isr() {
      * loop to 10 iterations. Beyond that, there's no way to ensure correct pulse
      * timing, since the MCU isn't fast enough.
      */
-    if (!--max_loops) next_isr_ticks = min_ticks;
+    if (!--max_loops) {
+      next_isr_ticks = min_ticks;
+      #ifdef HAL_STEPPER_TRACE_OVERRUN
+        HAL_STEPPER_TRACE_OVERRUN();
+      #endif
+    }
 
     // Advance pulses if not enough time to wait for the next ISR
   } while (next_isr_ticks < min_ticks);
@@ -1531,6 +1580,12 @@ void Stepper::pulse_phase_isr() {
   const uint32_t pending_events = step_event_count - step_events_completed;
   uint8_t events_to_do = _MIN(pending_events, steps_per_isr);
 
+  #if ENABLED(ARC_BLOCKS)
+    // Don't run an arc block past the chords that are ready
+    if (IS_ARC(current_block))
+      NOMORE(events_to_do, arc_events + uint32_t(arc_queued) * (current_block->arc.chord_events << oversampling_factor));
+  #endif
+
   // Just update the value we will get at the end of the loop
   step_events_completed += events_to_do;
 
@@ -1680,6 +1735,20 @@ void Stepper::pulse_phase_isr() {
     #endif // DIRECT_STEPPING
 
     if (!is_page) {
+      #if ENABLED(ARC_BLOCKS)
+        // Arc block? Aim X and Y at the next chord when this one is done
+        if (IS_ARC(current_block)) {
+          if (!arc_events) {
+            const uint8_t dm = arc_next_chord();
+            if (dm != last_direction_bits) {
+              last_direction_bits = dm;
+              set_directions();
+            }
+          }
+          --arc_events;
+        }
+      #endif
+
       // Determine if pulses are needed
       #if HAS_X_STEP
         PULSE_PREP(X);
@@ -1773,6 +1842,196 @@ void Stepper::pulse_phase_isr() {
   } while (--events_to_do);
 }
 
+#if ENABLED(PER_AXIS_STEP_TIMING)
+
+  #if HAS_E0_STEP && NONE(LIN_ADVANCE, MIXING_EXTRUDER)
+    #define HAS_E_AXIS_STEP_TIMING 1
+  #endif
+
+  /**
+   * With Bresenham every axis steps on a pulse phase, so the steps of slower
+   * axes land up to one step period of the fastest axis late. Instead, find the
+   * point between this pulse phase and the next where each slower axis' error
+   * term crosses zero, and step it at that time in axis_step_isr(). Its error
+   * term is then already paid, so the next pulse phase won't step it again.
+   *
+   * Steps due within 1/8 of the interval of each other share an ISR, and those
+   * that close to the next pulse phase are left to it, to save ISR entries.
+   */
+  void Stepper::schedule_axis_steps(const uint32_t interval) {
+    nextAxisISR = AXIS_STEP_NEVER;
+    axis_merge_ticks = interval >> 3;
+
+    // Multi-stepping puts several step events in one ISR, so there's nothing in between
+    const bool schedule = current_block && steps_per_isr == 1 && !IS_PAGE(current_block) && !IS_ARC(current_block);
+
+    #define AXIS_SCHEDULE(AXIS) do{ \
+      const uint32_t dividend = advance_dividend[_AXIS(AXIS)]; \
+      const int32_t err = delta_error[_AXIS(AXIS)]; \
+      uint32_t &due = axis_step_due[_AXIS(AXIS)]; \
+      due = AXIS_STEP_NEVER; \
+      if (schedule && dividend < advance_divisor && err + int32_t(dividend) >= 0) { \
+        const uint32_t ticks = uint64_t(-err) * interval / dividend; \
+        if (ticks + axis_merge_ticks < interval) { \
+          due = ticks; \
+          NOMORE(nextAxisISR, due); \
+        } \
+      } \
+    }while(0)
+
+    #if HAS_X_STEP
+      AXIS_SCHEDULE(X);
+    #endif
+    #if HAS_Y_STEP
+      AXIS_SCHEDULE(Y);
+    #endif
+    #if HAS_Z_STEP
+      AXIS_SCHEDULE(Z);
+    #endif
+    #if HAS_E_AXIS_STEP_TIMING
+      AXIS_SCHEDULE(E);
+    #endif
+
+    axis_isr_time = nextAxisISR;  // Ticks since this pulse phase when axis_step_isr() runs
+  }
+
+  // Step every minor axis that is due now and return the ticks to the next one
+  uint32_t Stepper::axis_step_isr() {
+
+    // An aborted block drops its pending steps
+    if (abort_current_block || !current_block) return AXIS_STEP_NEVER;
+
+    #if ISR_MULTI_STEPS
+      USING_TIMED_PULSE();
+    #endif
+    xyze_bool_t step_needed{0};
+    uint32_t next_due = AXIS_STEP_NEVER;
+
+    #define AXIS_STEP_PREP(AXIS) do{ \
+      uint32_t &due = axis_step_due[_AXIS(AXIS)]; \
+      if (due <= axis_isr_time + axis_merge_ticks) { \
+        step_needed[_AXIS(AXIS)] = true; \
+        count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+        delta_error[_AXIS(AXIS)] -= advance_divisor; \
+        due = AXIS_STEP_NEVER; \
+      } \
+      else \
+        NOMORE(next_due, due); \
+    }while(0)
+
+    #if HAS_X_STEP
+      AXIS_STEP_PREP(X);
+    #endif
+    #if HAS_Y_STEP
+      AXIS_STEP_PREP(Y);
+    #endif
+    #if HAS_Z_STEP
+      AXIS_STEP_PREP(Z);
+    #endif
+    #if HAS_E_AXIS_STEP_TIMING
+      AXIS_STEP_PREP(E);
+    #endif
+
+    // Pulse start
+    #if HAS_X_STEP
+      PULSE_START(X);
+    #endif
+    #if HAS_Y_STEP
+      PULSE_START(Y);
+    #endif
+    #if HAS_Z_STEP
+      PULSE_START(Z);
+    #endif
+    #if HAS_E_AXIS_STEP_TIMING
+      PULSE_START(E);
+    #endif
+
+    #if ISR_MULTI_STEPS
+      START_HIGH_PULSE();
+      AWAIT_HIGH_PULSE();
+    #endif
+
+    // Pulse stop
+    #if HAS_X_STEP
+      PULSE_STOP(X);
+    #endif
+    #if HAS_Y_STEP
+      PULSE_STOP(Y);
+    #endif
+    #if HAS_Z_STEP
+      PULSE_STOP(Z);
+    #endif
+    #if HAS_E_AXIS_STEP_TIMING
+      PULSE_STOP(E);
+    #endif
+
+    if (next_due == AXIS_STEP_NEVER) return AXIS_STEP_NEVER;
+    const uint32_t wait = next_due - axis_isr_time;
+    axis_isr_time = next_due;
+    return wait;
+  }
+
+#endif // PER_AXIS_STEP_TIMING
+
+#if ENABLED(ARC_BLOCKS)
+
+  /**
+   * An arc block runs as chords with the same number of step events each.
+   * Find the end of each chord by turning the radius vector, and give X and Y
+   * the Bresenham dividends that get them there within the chord. The divisor
+   * stays the block's, so Z and E step evenly along the arc.
+   *
+   * This float math runs in the block phase, a few chords ahead, so the pulse
+   * phase only takes the next chord from the queue.
+   */
+  void Stepper::arc_queue_chords() {
+    const block_arc_t &arc = current_block->arc;
+
+    while (arc_queued < ARC_CHORD_QUEUE && arc_chord < arc.chords) {
+      xy_long_t target;
+      if (++arc_chord < arc.chords) {
+        #if N_ARC_CORRECTION > 1
+          if (--arc_correct) {
+            const float r_new_Y = arc_radius.x * arc.sin_t + arc_radius.y * arc.cos_t;
+            arc_radius.x = arc_radius.x * arc.cos_t - arc_radius.y * arc.sin_t;
+            arc_radius.y = r_new_Y;
+          }
+          else
+        #endif
+        {
+          #if N_ARC_CORRECTION > 1
+            arc_correct = N_ARC_CORRECTION;
+          #endif
+          // Compute the radius vector afresh so round-off doesn't build up
+          const float angle = arc_chord * arc.theta, cos_a = cos(angle), sin_a = sin(angle);
+          arc_radius.x = -arc.center.x * cos_a + arc.center.y * sin_a;
+          arc_radius.y = -arc.center.x * sin_a - arc.center.y * cos_a;
+        }
+        target.set(
+          LROUND((arc.center.x + arc_radius.x) * planner.settings.axis_steps_per_mm[X_AXIS]),
+          LROUND((arc.center.y + arc_radius.y) * planner.settings.axis_steps_per_mm[Y_AXIS])
+        );
+      }
+      else
+        target = arc.end;   // The last chord ends exactly on the target
+
+      const int32_t dx = target.x - arc_pos.x, dy = target.y - arc_pos.y;
+      arc_pos = target;
+
+      // An axis that doesn't move in this chord keeps its direction
+      if (dx < 0) SBI(arc_direction_bits, X_AXIS); else if (dx > 0) CBI(arc_direction_bits, X_AXIS);
+      if (dy < 0) SBI(arc_direction_bits, Y_AXIS); else if (dy > 0) CBI(arc_direction_bits, Y_AXIS);
+
+      // Scaled by the chord count to share the block's divisor
+      arc_chord_t &chord = arc_queue[(arc_queue_tail + arc_queued) & (ARC_CHORD_QUEUE - 1)];
+      chord.dividend.set(uint32_t(ABS(dx)) * arc.chords << 1, uint32_t(ABS(dy)) * arc.chords << 1);
+      chord.direction_bits = arc_direction_bits;
+      ++arc_queued;
+    }
+  }
+
+#endif // ARC_BLOCKS
+
 // This is the last half of the stepper interrupt: This one processes and
 // properly schedules blocks from the planner. This is executed after creating
 // the step pulses, so it is not time critical, as pulses are already done.
@@ -1785,6 +2044,9 @@ uint32_t Stepper::block_phase_isr() {
   // If there is a current block
   if (current_block) {
 
+    // Refill the chords the pulse phase took
+    TERN_(ARC_BLOCKS, if (IS_ARC(current_block)) arc_queue_chords());
+
     // If current block is finished, reset pointer and finalize state
     if (step_events_completed >= step_event_count) {
       #if ENABLED(DIRECT_STEPPING)
@@ -1812,20 +2074,58 @@ uint32_t Stepper::block_phase_isr() {
       // Are we in acceleration phase ?
       if (step_events_completed <= accelerate_until) { // Calculate new timer value
 
-        #if ENABLED(S_CURVE_ACCELERATION)
-          // Get the next speed to use (Jerk limited!)
-          uint32_t acc_step_rate = acceleration_time < current_block->acceleration_time
-                                   ? _eval_bezier_curve(acceleration_time)
-                                   : current_block->cruise_rate;
-        #else
-          acc_step_rate = STEP_MULTIPLY(acceleration_time, current_block->acceleration_rate) + current_block->initial_rate;
-          NOMORE(acc_step_rate, current_block->nominal_rate);
+        #if ENABLED(STEP_INTERVAL_TABLE)
+          // The planner worked out the start of the ramp
+          if (step_table_index < current_block->accel_intervals)
+            interval = step_table_interval();
+          else
         #endif
+        {
+          #if ENABLED(S_CURVE_ACCELERATION)
+            // Get the next speed to use (Jerk limited!)
+            uint32_t acc_step_rate = acceleration_time < current_block->acceleration_time
+                                     ? _eval_bezier_curve(acceleration_time)
+                                     : current_block->cruise_rate;
+          #else
+            acc_step_rate = STEP_MULTIPLY(acceleration_time, current_block->acceleration_rate) + current_block->initial_rate;
+            NOMORE(acc_step_rate, current_block->nominal_rate);
+          #endif
 
-        // acc_step_rate is in steps/second
+          // acc_step_rate is in steps/second
+
+          // step_rate to timer interval and steps per stepper isr
+          interval = calc_timer_interval(acc_step_rate, &steps_per_isr);
+
+          // Update laser - Accelerating
+          #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+            if (laser_trap.enabled) {
+              #if DISABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
+                if (current_block->laser.entry_per) {
+                  laser_trap.acc_step_count -= step_events_completed - laser_trap.last_step_count;
+                  laser_trap.last_step_count = step_events_completed;
+
+                  // Should be faster than a divide, since this should trip just once
+                  if (laser_trap.acc_step_count < 0) {
+                    while (laser_trap.acc_step_count < 0) {
+                      laser_trap.acc_step_count += current_block->laser.entry_per;
+                      if (laser_trap.cur_power < current_block->laser.power) laser_trap.cur_power++;
+                    }
+                    cutter.set_ocr_power(laser_trap.cur_power);
+                  }
+                }
+              #else
+                if (laser_trap.till_update)
+                  laser_trap.till_update--;
+                else {
+                  laser_trap.till_update = LASER_POWER_INLINE_TRAPEZOID_CONT_PER;
+                  laser_trap.cur_power = (current_block->laser.power * acc_step_rate) / current_block->nominal_rate;
+                  cutter.set_ocr_power(laser_trap.cur_power); // Cycle efficiency is irrelevant it the last line was many cycles
+                }
+              #endif
+            }
+          #endif
+        }
 
-        // step_rate to timer interval and steps per stepper isr
-        interval = calc_timer_interval(acc_step_rate, &steps_per_isr);
         acceleration_time += interval;
 
         #if ENABLED(LIN_ADVANCE)
@@ -1835,71 +2135,88 @@ uint32_t Stepper::block_phase_isr() {
           }
           else if (LA_steps) nextAdvanceISR = 0;
         #endif
-
-        // Update laser - Accelerating
-        #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
-          if (laser_trap.enabled) {
-            #if DISABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
-              if (current_block->laser.entry_per) {
-                laser_trap.acc_step_count -= step_events_completed - laser_trap.last_step_count;
-                laser_trap.last_step_count = step_events_completed;
-
-                // Should be faster than a divide, since this should trip just once
-                if (laser_trap.acc_step_count < 0) {
-                  while (laser_trap.acc_step_count < 0) {
-                    laser_trap.acc_step_count += current_block->laser.entry_per;
-                    if (laser_trap.cur_power < current_block->laser.power) laser_trap.cur_power++;
-                  }
-                  cutter.set_ocr_power(laser_trap.cur_power);
-                }
-              }
-            #else
-              if (laser_trap.till_update)
-                laser_trap.till_update--;
-              else {
-                laser_trap.till_update = LASER_POWER_INLINE_TRAPEZOID_CONT_PER;
-                laser_trap.cur_power = (current_block->laser.power * acc_step_rate) / current_block->nominal_rate;
-                cutter.set_ocr_power(laser_trap.cur_power); // Cycle efficiency is irrelevant it the last line was many cycles
-              }
-            #endif
-          }
-        #endif
       }
       // Are we in Deceleration phase ?
       else if (step_events_completed > decelerate_after) {
-        uint32_t step_rate;
-
-        #if ENABLED(S_CURVE_ACCELERATION)
-          // If this is the 1st time we process the 2nd half of the trapezoid...
-          if (!bezier_2nd_half) {
-            // Initialize the Bézier speed curve
-            _calc_bezier_curve_coeffs(current_block->cruise_rate, current_block->final_rate, current_block->deceleration_time_inverse);
-            bezier_2nd_half = true;
-            // The first point starts at cruise rate. Just save evaluation of the Bézier curve
-            step_rate = current_block->cruise_rate;
-          }
-          else {
-            // Calculate the next speed to use
-            step_rate = deceleration_time < current_block->deceleration_time
-              ? _eval_bezier_curve(deceleration_time)
-              : current_block->final_rate;
-          }
-        #else
 
-          // Using the old trapezoidal control
-          step_rate = STEP_MULTIPLY(deceleration_time, current_block->acceleration_rate);
-          if (step_rate < acc_step_rate) { // Still decelerating?
-            step_rate = acc_step_rate - step_rate;
-            NOLESS(step_rate, current_block->final_rate);
-          }
+        #if ENABLED(STEP_INTERVAL_TABLE)
+          // The planner worked out the start of the ramp
+          if (step_table_index < current_block->accel_intervals + current_block->decel_intervals)
+            interval = step_table_interval();
           else
-            step_rate = current_block->final_rate;
         #endif
+        {
+          uint32_t step_rate;
+
+          #if ENABLED(S_CURVE_ACCELERATION)
+            // If this is the 1st time we process the 2nd half of the trapezoid...
+            if (!bezier_2nd_half) {
+              // Initialize the Bézier speed curve
+              _calc_bezier_curve_coeffs(current_block->cruise_rate, current_block->final_rate, current_block->deceleration_time_inverse);
+              bezier_2nd_half = true;
+              // The first point starts at cruise rate. Just save evaluation of the Bézier curve
+              step_rate = current_block->cruise_rate;
+              #if ENABLED(STEP_INTERVAL_TABLE)
+                // ...unless the table already took the ramp past it
+                if (deceleration_time)
+                  step_rate = deceleration_time < current_block->deceleration_time
+                    ? _eval_bezier_curve(deceleration_time)
+                    : current_block->final_rate;
+              #endif
+            }
+            else {
+              // Calculate the next speed to use
+              step_rate = deceleration_time < current_block->deceleration_time
+                ? _eval_bezier_curve(deceleration_time)
+                : current_block->final_rate;
+            }
+          #else
+
+            // Using the old trapezoidal control
+            step_rate = STEP_MULTIPLY(deceleration_time, current_block->acceleration_rate);
+            if (step_rate < acc_step_rate) { // Still decelerating?
+              step_rate = acc_step_rate - step_rate;
+              NOLESS(step_rate, current_block->final_rate);
+            }
+            else
+              step_rate = current_block->final_rate;
+          #endif
 
-        // step_rate is in steps/second
+          // step_rate is in steps/second
+
+          // step_rate to timer interval and steps per stepper isr
+          interval = calc_timer_interval(step_rate, &steps_per_isr);
+
+          // Update laser - Decelerating
+          #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+            if (laser_trap.enabled) {
+              #if DISABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
+                if (current_block->laser.exit_per) {
+                  laser_trap.acc_step_count -= step_events_completed - laser_trap.last_step_count;
+                  laser_trap.last_step_count = step_events_completed;
+
+                  // Should be faster than a divide, since this should trip just once
+                  if (laser_trap.acc_step_count < 0) {
+                    while (laser_trap.acc_step_count < 0) {
+                      laser_trap.acc_step_count += current_block->laser.exit_per;
+                      if (laser_trap.cur_power > current_block->laser.power_exit) laser_trap.cur_power--;
+                    }
+                    cutter.set_ocr_power(laser_trap.cur_power);
+                  }
+                }
+              #else
+                if (laser_trap.till_update)
+                  laser_trap.till_update--;
+                else {
+                  laser_trap.till_update = LASER_POWER_INLINE_TRAPEZOID_CONT_PER;
+                  laser_trap.cur_power = (current_block->laser.power * step_rate) / current_block->nominal_rate;
+                  cutter.set_ocr_power(laser_trap.cur_power); // Cycle efficiency isn't relevant when the last line was many cycles
+                }
+              #endif
+            }
+          #endif
+        }
 
-        // step_rate to timer interval and steps per stepper isr
-        interval = calc_timer_interval(step_rate, &steps_per_isr);
         deceleration_time += interval;
 
         #if ENABLED(LIN_ADVANCE)
@@ -1912,35 +2229,6 @@ uint32_t Stepper::block_phase_isr() {
           }
           else if (LA_steps) nextAdvanceISR = 0;
         #endif // LIN_ADVANCE
-
-        // Update laser - Decelerating
-        #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
-          if (laser_trap.enabled) {
-            #if DISABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
-              if (current_block->laser.exit_per) {
-                laser_trap.acc_step_count -= step_events_completed - laser_trap.last_step_count;
-                laser_trap.last_step_count = step_events_completed;
-
-                // Should be faster than a divide, since this should trip just once
-                if (laser_trap.acc_step_count < 0) {
-                  while (laser_trap.acc_step_count < 0) {
-                    laser_trap.acc_step_count += current_block->laser.exit_per;
-                    if (laser_trap.cur_power > current_block->laser.power_exit) laser_trap.cur_power--;
-                  }
-                  cutter.set_ocr_power(laser_trap.cur_power);
-                }
-              }
-            #else
-              if (laser_trap.till_update)
-                laser_trap.till_update--;
-              else {
-                laser_trap.till_update = LASER_POWER_INLINE_TRAPEZOID_CONT_PER;
-                laser_trap.cur_power = (current_block->laser.power * step_rate) / current_block->nominal_rate;
-                cutter.set_ocr_power(laser_trap.cur_power); // Cycle efficiency isn't relevant when the last line was many cycles
-              }
-            #endif
-          }
-        #endif
       }
       // Must be in cruise phase otherwise
       else {
@@ -2120,6 +2408,22 @@ uint32_t Stepper::block_phase_isr() {
       advance_dividend = current_block->steps << 1;
       advance_divisor = step_event_count << 1;
 
+      #if ENABLED(ARC_BLOCKS)
+        // Arc block? Queue the first chords and start on the first one
+        if (IS_ARC(current_block)) {
+          arc_queue_tail = arc_queued = 0;
+          arc_radius = -current_block->arc.center;
+          arc_pos.reset();
+          arc_chord = 0;
+          arc_direction_bits = current_block->direction_bits;
+          #if N_ARC_CORRECTION > 1
+            arc_correct = N_ARC_CORRECTION;
+          #endif
+          arc_queue_chords();
+          current_block->direction_bits = arc_next_chord();
+        }
+      #endif
+
       // No step events completed so far
       step_events_completed = 0;
 
@@ -2127,6 +2431,10 @@ uint32_t Stepper::block_phase_isr() {
       accelerate_until = current_block->accelerate_until << oversampling;
       decelerate_after = current_block->decelerate_after << oversampling;
 
+      #ifdef HAL_STEPPER_TRACE_BLOCK
+        HAL_STEPPER_TRACE_BLOCK(current_block); // Let the HAL record the planned trapezoid
+      #endif
+
       #if ENABLED(MIXING_EXTRUDER)
         MIXER_STEPPER_SETUP();
       #endif
@@ -2220,10 +2528,12 @@ uint32_t Stepper::block_phase_isr() {
         // We haven't started the 2nd half of the trapezoid
         bezier_2nd_half = false;
       #else
-        // Set as deceleration point the initial rate of the block
-        acc_step_rate = current_block->initial_rate;
+        // Set as deceleration point the initial rate of the block (or where a tabled ramp ends)
+        acc_step_rate = TERN(STEP_INTERVAL_TABLE, current_block->accel_end_rate, current_block->initial_rate);
       #endif
 
+      TERN_(STEP_INTERVAL_TABLE, step_table_index = 0);
+
       // Calculate the initial timer interval
       interval = calc_timer_interval(current_block->initial_rate, &steps_per_isr);
     }
@@ -2248,6 +2558,111 @@ uint32_t Stepper::block_phase_isr() {
   return interval;
 }
 
+#if ENABLED(STEP_INTERVAL_TABLE)
+
+  #if ENABLED(S_CURVE_ACCELERATION)
+
+    // A Bézier speed curve outside of the ISR, with the same math as _eval_bezier_curve()
+    struct bezier_curve_t {
+      int32_t a, b, c;
+      uint32_t f, av;
+
+      bezier_curve_t(const int32_t v0, const int32_t v1, const uint32_t av)
+        : a(768 * (v1 - v0)), b(1920 * (v0 - v1)), c(1280 * (v1 - v0)), f(128 * v0), av(av) {}
+
+      int32_t eval(const uint32_t curr_step) const {
+        const uint32_t t = av * curr_step;
+        uint64_t p = t;
+        p *= t; p >>= 32;
+        p *= t; p >>= 32;
+        int64_t acc = (int64_t)f << 31;
+        acc += ((uint32_t)p >> 1) * (int64_t)c;
+        p *= t; p >>= 32;
+        acc += ((uint32_t)p >> 1) * (int64_t)b;
+        p *= t; p >>= 32;
+        acc += ((uint32_t)p >> 1) * (int64_t)a;
+        acc >>= (31 + 7);
+        return (int32_t)acc;
+      }
+    };
+
+  #endif
+
+  /**
+   * Run the acceleration and deceleration phases of block_phase_isr() ahead of
+   * time and keep their intervals in the block. The acceleration ramp gets up to
+   * STEP_INTERVAL_TABLE_SIZE entries and the deceleration ramp the rest of the
+   * table. The ISR works out any further intervals of a longer ramp itself.
+   */
+  void Stepper::calc_step_intervals(block_t * const block) {
+    constexpr uint8_t table_size = COUNT(block->step_intervals);
+    uint8_t n = 0, loops;
+
+    #define STEP_TABLE_ENTRY(I) ((uint32_t(I) << 8) | loops)
+
+    // Acceleration, from the first block phase after the block is loaded
+    uint32_t events = 0, time = 0;
+    calc_timer_interval(block->initial_rate, &loops);
+    #if ENABLED(S_CURVE_ACCELERATION)
+      const bezier_curve_t accel_curve(block->initial_rate, block->cruise_rate, block->acceleration_time_inverse);
+    #else
+      uint32_t rate = block->initial_rate;
+    #endif
+    bool ramp_fits = true;
+    for (;;) {
+      events += loops;
+      if (events >= block->step_event_count || events > block->accelerate_until) break;
+      if (n == STEP_INTERVAL_TABLE_SIZE) { ramp_fits = false; break; }
+      #if ENABLED(S_CURVE_ACCELERATION)
+        const uint32_t rate = time < block->acceleration_time ? accel_curve.eval(time) : block->cruise_rate;
+      #else
+        rate = STEP_MULTIPLY(time, block->acceleration_rate) + block->initial_rate;
+        NOMORE(rate, block->nominal_rate);
+      #endif
+      const uint32_t interval = calc_timer_interval(rate, &loops);
+      time += interval;
+      block->step_intervals[n++] = STEP_TABLE_ENTRY(interval);
+    }
+    block->accel_intervals = n;
+
+    #if DISABLED(S_CURVE_ACCELERATION)
+      // Deceleration starts from the last acceleration rate, known only if the table has the whole ramp
+      block->accel_end_rate = rate;
+      if (!ramp_fits) { block->decel_intervals = 0; return; }
+    #else
+      UNUSED(ramp_fits);
+      const bezier_curve_t decel_curve(block->cruise_rate, block->final_rate, block->deceleration_time_inverse);
+    #endif
+
+    // Deceleration, from the first step event it can start on. Any entries
+    // past the end of the block, if it starts later, are never used.
+    events = _MAX(block->accelerate_until, block->decelerate_after) + 1;
+    time = 0;
+    while (events < block->step_event_count && n < table_size) {
+      uint32_t step_rate;
+      #if ENABLED(S_CURVE_ACCELERATION)
+        step_rate = !time ? block->cruise_rate
+                  : time < block->deceleration_time ? decel_curve.eval(time)
+                  : block->final_rate;
+      #else
+        step_rate = STEP_MULTIPLY(time, block->acceleration_rate);
+        if (step_rate < rate) {
+          step_rate = rate - step_rate;
+          NOLESS(step_rate, block->final_rate);
+        }
+        else
+          step_rate = block->final_rate;
+      #endif
+      const uint32_t interval = calc_timer_interval(step_rate, &loops);
+      time += interval;
+      block->step_intervals[n++] = STEP_TABLE_ENTRY(interval);
+      events += loops;
+    }
+    block->decel_intervals = n - block->accel_intervals;
+  }
+
+#endif // STEP_INTERVAL_TABLE
+
 #if ENABLED(LIN_ADVANCE)
 
   // Timer interrupt for E. LA_steps is set in the main routine
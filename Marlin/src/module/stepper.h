@@ -322,6 +322,37 @@ class Stepper {
       static bool bezier_2nd_half; // If Bézier curve has been initialized or not
     #endif
 
+    #if ENABLED(PER_AXIS_STEP_TIMING)
+      static constexpr uint32_t AXIS_STEP_NEVER = 0xFFFFFFFF;
+      static uint32_t nextAxisISR,          // Ticks until the next minor axis step
+                      axis_isr_time,        // Ticks from the last pulse phase to the current axis step
+                      axis_merge_ticks;     // Steps due this close together are taken in one ISR
+      static xyze_ulong_t axis_step_due;    // Ticks from the last pulse phase to the step of each minor axis
+    #endif
+
+    #if ENABLED(STEP_INTERVAL_TABLE)
+      static uint8_t step_table_index;      // The next entry of the current block's interval table
+    #endif
+
+    #if ENABLED(ARC_BLOCKS)
+      #define ARC_CHORD_QUEUE 8             // Chords worked out ahead of the pulse phase (power of 2)
+      typedef struct {
+        xy_ulong_t dividend;                // Bresenham dividends of X and Y for the chord
+        uint8_t direction_bits;             // Direction bits for the chord
+      } arc_chord_t;
+      static arc_chord_t arc_queue[ARC_CHORD_QUEUE];
+      static uint8_t arc_queue_tail,        // The next chord for the pulse phase
+                     arc_queued;            // Chords ready in the queue
+      static xy_float_t arc_radius;         // Arc center to the end of the last queued chord (mm)
+      static xy_long_t arc_pos;             // End of the last queued chord from the start of the arc (steps)
+      static uint16_t arc_chord;            // Index of the last queued chord
+      static uint8_t arc_direction_bits;    // Direction bits of the last queued chord
+      static uint32_t arc_events;           // Step events left in the current chord
+      #if N_ARC_CORRECTION > 1
+        static uint8_t arc_correct;         // Chords left until the radius vector is recomputed
+      #endif
+    #endif
+
     #if ENABLED(LIN_ADVANCE)
       static constexpr uint32_t LA_ADV_NEVER = 0xFFFFFFFF;
       static uint32_t nextAdvanceISR, LA_isr_rate;
@@ -399,6 +430,13 @@ class Stepper {
     // The stepper block processing ISR phase
     static uint32_t block_phase_isr();
 
+    #if ENABLED(PER_AXIS_STEP_TIMING)
+      // Find the minor axis steps due before the next pulse phase
+      static void schedule_axis_steps(const uint32_t interval);
+      // The per-axis step ISR phase
+      static uint32_t axis_step_isr();
+    #endif
+
     #if ENABLED(LIN_ADVANCE)
       // The Linear advance ISR phase
       static uint32_t advance_isr();
@@ -416,6 +454,11 @@ class Stepper {
       }
     #endif
 
+    #if ENABLED(STEP_INTERVAL_TABLE)
+      // Fill a block's interval table - Called by the planner while the block is flagged RECALCULATE
+      static void calc_step_intervals(block_t * const block);
+    #endif
+
     // Check if the given block is busy or not - Must not be called from ISR contexts
     static bool is_block_busy(const block_t* const block);
 
@@ -582,6 +625,31 @@ class Stepper {
       return timer;
     }
 
+    #if ENABLED(STEP_INTERVAL_TABLE)
+      // Take the next interval and steps per ISR from the current block's table
+      FORCE_INLINE static uint32_t step_table_interval() {
+        const uint32_t entry = current_block->step_intervals[step_table_index++];
+        steps_per_isr = uint8_t(entry);
+        return entry >> 8;
+      }
+    #endif
+
+    #if ENABLED(ARC_BLOCKS)
+      // Work out the chords of an arc block until the queue is full
+      static void arc_queue_chords();
+
+      // Aim X and Y at the end of the next queued chord. Return its direction bits.
+      FORCE_INLINE static uint8_t arc_next_chord() {
+        const arc_chord_t &chord = arc_queue[arc_queue_tail];
+        arc_queue_tail = (arc_queue_tail + 1) & (ARC_CHORD_QUEUE - 1);
+        --arc_queued;
+        advance_dividend.x = chord.dividend.x;
+        advance_dividend.y = chord.dividend.y;
+        arc_events = current_block->arc.chord_events << oversampling_factor;
+        return chord.direction_bits;
+      }
+    #endif
+
     #if ENABLED(S_CURVE_ACCELERATION)
       static void _calc_bezier_curve_coeffs(const int32_t v0, const int32_t v1, const uint32_t av);
       static int32_t _eval_bezier_curve(const uint32_t curr_step);
@@ -77,6 +77,11 @@
   #include "stepper.h"
 #endif
 
+#if BOTH(MPCTEMP, HAS_FAN)
+  // The part cooling fan of a hotend. With fewer fans than hotends fan 0 cools them all.
+  #define MPC_FAN_INDEX(E) ((FAN_COUNT) >= (HOTENDS) ? (E) : 0)
+#endif
+
 #if ENABLED(BABYSTEPPING) && DISABLED(INTEGRATED_BABYSTEPPING)
   #include "../feature/babystep.h"
 #endif
@@ -647,6 +652,202 @@ volatile bool Temperature::raw_temps_ready = false;
 
 #endif // HAS_PID_HEATING
 
+#if ENABLED(MPCTEMP)
+
+  void Temperature::log_mpc(const uint8_t e, const bool eprom/*=false*/) {
+    if (eprom)
+      SERIAL_ECHOPGM("  M306");
+    else
+      SERIAL_ECHO_START();
+
+    const MPC_t &mpc = temp_hotend[e].mpc;
+
+    SERIAL_ECHOPAIR(" E", int(e), " S", int(mpc.enabled));
+    SERIAL_ECHOPAIR_F_P(SP_P_STR, mpc.heater_power, 2);
+    SERIAL_ECHOPAIR_F_P(SP_C_STR, mpc.block_heat_capacity, 2);
+    SERIAL_ECHOPAIR_F(" R", mpc.sensor_responsiveness, 4);
+    SERIAL_ECHOPAIR_F_P(SP_A_STR, mpc.ambient_xfer_coeff_fan0, 4);
+    SERIAL_ECHOPAIR_F(" F", mpc.ambient_xfer_coeff_fan0 + mpc.fan255_adjustment, 4);
+    SERIAL_ECHOPAIR_F(" H", mpc.filament_heat_capacity_permm, 4);
+    SERIAL_EOL();
+  }
+
+  /**
+   * Measure the model constants of a hotend, as with M306 T:
+   *  - Cool to ambient with the fan on, until the temperature stops falling.
+   *  - Heat at full power from ambient to 200C, sampling the curve from 100C.
+   *    The asymptote and time constant of three equally spaced samples give
+   *    the block heat capacity, the sensor lag and a first heat loss.
+   *  - Hold 200C under MPC, with the fan off and then on full, and measure the
+   *    power needed to get the heat losses more accurately.
+   */
+  void Temperature::MPC_autotune(const uint8_t e) {
+    constexpr float tune_temp = 200.0f, sample_start_temp = 100.0f;
+    constexpr millis_t settle_ms = 60000UL, measure_ms = 30000UL;
+
+    hotend_info_t &hotend = temp_hotend[e];
+    MPC_t &mpc = hotend.mpc;
+    const MPC_t old_mpc = mpc;
+
+    #if HAS_FAN
+      const uint8_t fan = MPC_FAN_INDEX(e), old_fan_speed = fan_speed[fan];
+    #endif
+
+    if (tune_temp > temp_range[e].maxtemp - (HOTEND_OVERSHOOT)) {
+      SERIAL_ECHOLNPGM(STR_MPC_TEMP_TOO_HIGH);
+      return;
+    }
+
+    millis_t ms = millis(), next_report_ms = ms;
+    float current_temp = degHotend(e);
+
+    // Wait for the next reading. False if aborted with M108.
+    auto next_reading = [&]{
+      do {
+        ms = millis();
+        TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update());
+        if (!wait_for_heatup) return false;
+      } while (!raw_temps_ready);
+      updateTemperaturesFromRawValues();
+      current_temp = degHotend(e);
+      // Report heater states every 2 seconds
+      if (ELAPSED(ms, next_report_ms)) {
+        #if HAS_TEMP_SENSOR
+          print_heater_states(e);
+          SERIAL_EOL();
+        #endif
+        next_report_ms = ms + 2000UL;
+      }
+      return wait_for_heatup;
+    };
+
+    SERIAL_ECHOLNPGM(STR_MPC_AUTOTUNE_START);
+
+    disable_all_heaters();
+    TERN_(AUTO_POWER_CONTROL, powerManager.power_on());
+    TERN_(NO_FAN_SLOWING_IN_PID_TUNING, adaptive_fan_slowing = false);
+
+    float ambient_temp;
+    bool tuned = false;
+    wait_for_heatup = true; // Can be interrupted with M108
+
+    {
+      SERIAL_ECHOLNPGM(STR_MPC_COOLING_TO_AMBIENT);
+      TERN_(HAS_FAN, set_fan_speed(fan, 255));
+      ambient_temp = current_temp;
+      millis_t next_test_ms = ms + 10000UL;
+      for (;;) {
+        if (!next_reading()) goto EXIT_M306;
+        if (ELAPSED(ms, next_test_ms)) {
+          if (current_temp >= ambient_temp) {
+            ambient_temp = (ambient_temp + current_temp) * 0.5f;
+            break;
+          }
+          ambient_temp = current_temp;
+          next_test_ms += 10000UL;
+        }
+      }
+      TERN_(HAS_FAN, set_fan_speed(fan, 0));
+    }
+
+    {
+      SERIAL_ECHOLNPGM(STR_MPC_HEATING_PAST_200);
+      hotend.target = tune_temp; // For the temperature reports
+      hotend.soft_pwm_amount = (MPC_MAX) >> 1;
+
+      // Samples at sample_distance seconds, spaced more widely when the buffer fills
+      float samples[16], t1_time = 0;
+      uint8_t sample_count = 0;
+      uint16_t sample_distance = 1;
+      const millis_t heat_start_ms = ms;
+      millis_t next_test_ms = ms;
+      while (current_temp < tune_temp) {
+        if (!next_reading()) goto EXIT_M306;
+        if (ELAPSED(ms, next_test_ms)) {
+          if (current_temp >= sample_start_temp) {
+            if (sample_count == COUNT(samples)) {
+              LOOP_L_N(i, COUNT(samples) / 2) samples[i] = samples[i * 2];
+              sample_count /= 2;
+              sample_distance *= 2;
+            }
+            if (sample_count == 0) t1_time = (ms - heat_start_ms) * 0.001f;
+            samples[sample_count++] = current_temp;
+          }
+          next_test_ms += SEC_TO_MS(sample_distance);
+        }
+        if (ELAPSED(ms, heat_start_ms + SEC_TO_MS(20 * 60))) {
+          SERIAL_ECHOLNPGM(STR_MPC_TIMEOUT);
+          goto EXIT_M306;
+        }
+      }
+
+      if (sample_count < 3) {
+        SERIAL_ECHOLNPGM(STR_MPC_TEMPERATURE_ERROR);
+        goto EXIT_M306;
+      }
+
+      // An odd number of samples gives three equally spaced ones
+      if (!TEST(sample_count, 0)) sample_count--;
+      const float t1 = samples[0], t2 = samples[sample_count >> 1], t3 = samples[sample_count - 1];
+      if (2 * t2 - t1 - t3 <= 0) {
+        SERIAL_ECHOLNPGM(STR_MPC_TEMPERATURE_ERROR);
+        goto EXIT_M306;
+      }
+      const float asymp_temp = (t2 * t2 - t1 * t3) / (2 * t2 - t1 - t3),
+                  block_responsiveness = -logf((t2 - asymp_temp) / (t1 - asymp_temp)) / (sample_distance * (sample_count >> 1));
+
+      // A first estimate of the constants, from the heating curve
+      mpc.ambient_xfer_coeff_fan0 = mpc.heater_power * (MPC_MAX) / 255 / (asymp_temp - ambient_temp);
+      mpc.fan255_adjustment = 0;
+      mpc.block_heat_capacity = mpc.ambient_xfer_coeff_fan0 / block_responsiveness;
+      mpc.sensor_responsiveness = block_responsiveness / (1.0f - (ambient_temp - asymp_temp) * expf(-block_responsiveness * t1_time) / (t1 - asymp_temp));
+
+      hotend.modeled_block_temp = asymp_temp + (ambient_temp - asymp_temp) * expf(-block_responsiveness * (ms - heat_start_ms) * 0.001f);
+      hotend.modeled_sensor_temp = current_temp;
+      hotend.modeled_ambient_temp = ambient_temp;
+    }
+
+    {
+      SERIAL_ECHOLNPGM(STR_MPC_MEASURING_AMBIENT);
+
+      // Average power to hold the temperature, with the fan off and then on full
+      float power[1 + ENABLED(HAS_FAN)];
+      LOOP_L_N(f, COUNT(power)) {
+        TERN_(HAS_FAN, set_fan_speed(fan, f ? 255 : 0));
+        const millis_t measure_start_ms = ms + (f ? measure_ms : settle_ms);
+        float energy = 0, last_temp = current_temp;
+        while (PENDING(ms, measure_start_ms + measure_ms)) {
+          if (!next_reading()) goto EXIT_M306;
+          hotend.soft_pwm_amount = (int)get_mpc_output_hotend(e) >> 1;
+          if (ELAPSED(ms, measure_start_ms))
+            energy += mpc.heater_power * hotend.soft_pwm_amount / 127 * MPC_dT + (last_temp - current_temp) * mpc.block_heat_capacity;
+          last_temp = current_temp;
+        }
+        power[f] = energy / (measure_ms * 0.001f);
+      }
+
+      mpc.ambient_xfer_coeff_fan0 = power[0] / (tune_temp - ambient_temp);
+      TERN_(HAS_FAN, mpc.fan255_adjustment = power[1] / (tune_temp - ambient_temp) - mpc.ambient_xfer_coeff_fan0);
+    }
+
+    SERIAL_ECHOLNPGM(STR_MPC_AUTOTUNE_FINISHED);
+    SERIAL_ECHOLNPAIR_F("MPC_BLOCK_HEAT_CAPACITY ", mpc.block_heat_capacity, 4);
+    SERIAL_ECHOLNPAIR_F("MPC_SENSOR_RESPONSIVENESS ", mpc.sensor_responsiveness, 4);
+    SERIAL_ECHOLNPAIR_F("MPC_AMBIENT_XFER_COEFF ", mpc.ambient_xfer_coeff_fan0, 4);
+    SERIAL_ECHOLNPAIR_F("MPC_AMBIENT_XFER_COEFF_FAN255 ", mpc.ambient_xfer_coeff_fan0 + mpc.fan255_adjustment, 4);
+    tuned = true;
+
+    EXIT_M306:
+      if (!tuned) mpc = old_mpc; // Failed or interrupted, so keep the old constants
+      wait_for_heatup = false;
+      disable_all_heaters();
+      resetMPC(e);
+      TERN_(HAS_FAN, set_fan_speed(fan, old_fan_speed));
+      TERN_(NO_FAN_SLOWING_IN_PID_TUNING, adaptive_fan_slowing = true);
+  }
+
+#endif // MPCTEMP
+
 /**
  * Class and Instance Methods
  */
@@ -827,8 +1028,91 @@ void Temperature::min_temp_error(const heater_ind_t heater) {
     extern bool pid_debug_flag;
   #endif
 
+  #if ENABLED(MPCTEMP)
+
+    /**
+     * Model Predictive Control
+     *
+     * The heater block, the sensor and the ambient air are each modeled at one
+     * temperature. The block takes in the heater power and loses heat to the air,
+     * more with the fan on and with filament flowing, and the sensor follows the
+     * block. Part of the difference from the measured temperature is applied to
+     * the model every reading, so noise averages out and model errors decay.
+     *
+     * The power is planned to bring the block to the target in 2 seconds and to
+     * replace the expected losses, including the filament of the moves queued
+     * in the planner, so the heater reacts before the flow changes.
+     */
+    float Temperature::get_mpc_output_hotend(const uint8_t E_NAME) {
+      const uint8_t ee = HOTEND_INDEX;
+      hotend_info_t &hotend = temp_hotend[ee];
+      const MPC_t &mpc = hotend.mpc;
+
+      // Start the model from the measured temperature
+      if (isnan(hotend.modeled_block_temp)) {
+        hotend.modeled_ambient_temp = _MIN(30.0f, hotend.celsius); // Cap at a warm room
+        hotend.modeled_block_temp = hotend.modeled_sensor_temp = hotend.celsius;
+      }
+
+      // Heat lost to the air per degree above ambient
+      float ambient_xfer_coeff = mpc.ambient_xfer_coeff_fan0;
+      #if HAS_FAN
+        ambient_xfer_coeff += fan_speed[MPC_FAN_INDEX(ee)] * mpc.fan255_adjustment * RECIPROCAL(255);
+      #endif
+
+      // Filament of the current move and of the moves soon to come, which is heated from ambient
+      const uint8_t extruder = TERN(HAS_MULTI_HOTEND, ee, active_extruder);
+      const float xfer_coeff_now = ambient_xfer_coeff + planner.queued_extrusion_speed(extruder, 0) * mpc.filament_heat_capacity_permm,
+                  xfer_coeff_ahead = ambient_xfer_coeff + planner.queued_extrusion_speed(extruder, MPC_LOOKAHEAD) * mpc.filament_heat_capacity_permm;
+
+      // Update the modeled temperatures
+      float blocktempdelta = hotend.soft_pwm_amount * mpc.heater_power * (MPC_dT / 127) / mpc.block_heat_capacity;
+      blocktempdelta += (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * xfer_coeff_now * MPC_dT / mpc.block_heat_capacity;
+      hotend.modeled_block_temp += blocktempdelta;
+
+      const float sensortempdelta = (hotend.modeled_block_temp - hotend.modeled_sensor_temp) * (mpc.sensor_responsiveness * MPC_dT);
+      hotend.modeled_sensor_temp += sensortempdelta;
+
+      // Correct the model toward the measured temperature
+      const float delta_to_apply = (hotend.celsius - hotend.modeled_sensor_temp) * (MPC_SMOOTHING_FACTOR);
+      hotend.modeled_block_temp += delta_to_apply;
+      hotend.modeled_sensor_temp += delta_to_apply;
+
+      // Near steady state (power not clipped, or temperature settled) the error is in the ambient temperature
+      if (WITHIN(hotend.soft_pwm_amount, 1, 126) || ABS(blocktempdelta + delta_to_apply) < (MPC_STEADYSTATE) * (MPC_dT))
+        hotend.modeled_ambient_temp += delta_to_apply > 0
+          ? _MAX(delta_to_apply, (MPC_MIN_AMBIENT_CHANGE) * (MPC_dT))
+          : _MIN(delta_to_apply, -(MPC_MIN_AMBIENT_CHANGE) * (MPC_dT));
+
+      float power = 0;
+      if (hotend.target && !TERN0(HEATER_IDLE_HANDLER, hotend_idle[ee].timed_out)) {
+        power = (hotend.target - hotend.modeled_block_temp) * mpc.block_heat_capacity / 2.0f;
+        power += (hotend.modeled_block_temp - hotend.modeled_ambient_temp) * xfer_coeff_ahead;
+      }
+
+      // Round so the halved soft PWM amount covers 0 to 127
+      const float mpc_output = power * 254.0f / mpc.heater_power + 1.0f;
+
+      #if ENABLED(PID_DEBUG)
+        if (ee == active_extruder && pid_debug_flag) {
+          SERIAL_ECHO_START();
+          SERIAL_ECHOLNPAIR(STR_PID_DEBUG, ee, STR_PID_DEBUG_INPUT, hotend.celsius, STR_PID_DEBUG_OUTPUT, mpc_output,
+                            " block ", hotend.modeled_block_temp, " ambient ", hotend.modeled_ambient_temp);
+        }
+      #endif
+
+      return constrain(mpc_output, 0, MPC_MAX);
+    }
+
+  #endif // MPCTEMP
+
   float Temperature::get_pid_output_hotend(const uint8_t E_NAME) {
     const uint8_t ee = HOTEND_INDEX;
+
+    #if ENABLED(MPCTEMP)
+      if (temp_hotend[ee].mpc.enabled) return get_mpc_output_hotend(ee);
+    #endif
+
     #if ENABLED(PIDTEMP)
       #if DISABLED(PID_OPENLOOP)
         static hotend_pid_t work_pid[HOTENDS];
@@ -1241,6 +1525,74 @@ void Temperature::manage_heater() {
   }                                                                   \
 }while(0)
 
+#if ENABLED(THERMISTOR_LUT)
+
+  static_assert(WITHIN(THERMISTOR_LUT_SHIFT, 0, 15), "THERMISTOR_LUT_BITS is out of range for this ADC.");
+
+  /**
+   * A thermistor's temperature at evenly spaced raw readings, in 1/16 °C.
+   * Filled from the table search or the thermistor equation, so a reading
+   * only needs one indexed interpolation.
+   */
+  typedef struct {
+    int16_t celsius[_BV(THERMISTOR_LUT_BITS) + 1];
+
+    float to_celsius(const int raw) const {
+      const uint16_t r = constrain(raw, 0, MAX_RAW_THERMISTOR_VALUE), i = r >> (THERMISTOR_LUT_SHIFT);
+      const int32_t c0 = celsius[i], c1 = celsius[i + 1];
+      return (c0 * _BV(THERMISTOR_LUT_SHIFT) + (c1 - c0) * int32_t(r & (_BV(THERMISTOR_LUT_SHIFT) - 1)))
+             * (1.0f / (16UL << (THERMISTOR_LUT_SHIFT)));
+    }
+  } thermistor_lut_t;
+
+  // Fill a thermistor_lut_t from a conversion of 'raw'
+  #define FILL_THERMISTOR_LUT(LUT, CONV) do{                                              \
+    for (uint16_t i = 0; i <= _BV(THERMISTOR_LUT_BITS); i++) {                            \
+      const int raw = _MIN(uint32_t(i) << (THERMISTOR_LUT_SHIFT), uint32_t(MAX_RAW_THERMISTOR_VALUE)); \
+      (LUT).celsius[i] = constrain(LROUND((CONV) * 16), -32768L, 32767L);                 \
+    }                                                                                     \
+  }while(0)
+
+  #if HOTEND_USES_THERMISTOR
+    static thermistor_lut_t hotend_lut[COUNT(heater_ttbl_map)];
+  #endif
+  #if ENABLED(HEATER_BED_USES_THERMISTOR) && DISABLED(HEATER_BED_USER_THERMISTOR)
+    static thermistor_lut_t bed_lut;
+  #endif
+  #if ENABLED(HEATER_CHAMBER_USES_THERMISTOR) && DISABLED(HEATER_CHAMBER_USER_THERMISTOR)
+    static thermistor_lut_t chamber_lut;
+  #endif
+  #if ENABLED(PROBE_USES_THERMISTOR) && DISABLED(PROBE_USER_THERMISTOR)
+    static thermistor_lut_t probe_lut;
+  #endif
+  #if HAS_USER_THERMISTORS
+    static thermistor_lut_t user_thermistor_lut[USER_THERMISTORS]; // Filled when the thermistor changes
+  #endif
+
+  // The table search as a function, to fill the lookup tables
+  static float scan_thermistor_table(const temp_entry_t * const tbl, const uint8_t len, const int raw) {
+    SCAN_THERMISTOR_TABLE(tbl, len);
+  }
+
+  // Fill the lookup tables of the thermistors with a built-in table
+  static void fill_thermistor_luts() {
+    #if HOTEND_USES_THERMISTOR
+      LOOP_L_N(e, COUNT(hotend_lut))
+        if (heater_ttbllen_map[e]) FILL_THERMISTOR_LUT(hotend_lut[e], scan_thermistor_table(heater_ttbl_map[e], heater_ttbllen_map[e], raw));
+    #endif
+    #if ENABLED(HEATER_BED_USES_THERMISTOR) && DISABLED(HEATER_BED_USER_THERMISTOR)
+      FILL_THERMISTOR_LUT(bed_lut, scan_thermistor_table(BED_TEMPTABLE, BED_TEMPTABLE_LEN, raw));
+    #endif
+    #if ENABLED(HEATER_CHAMBER_USES_THERMISTOR) && DISABLED(HEATER_CHAMBER_USER_THERMISTOR)
+      FILL_THERMISTOR_LUT(chamber_lut, scan_thermistor_table(CHAMBER_TEMPTABLE, CHAMBER_TEMPTABLE_LEN, raw));
+    #endif
+    #if ENABLED(PROBE_USES_THERMISTOR) && DISABLED(PROBE_USER_THERMISTOR)
+      FILL_THERMISTOR_LUT(probe_lut, scan_thermistor_table(PROBE_TEMPTABLE, PROBE_TEMPTABLE_LEN, raw));
+    #endif
+  }
+
+#endif // THERMISTOR_LUT
+
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load()
@@ -1313,6 +1665,26 @@ void Temperature::manage_heater() {
     SERIAL_EOL();
   }
 
+  // The thermistor equation, with the pre-calculated variables of a user thermistor
+  static float user_thermistor_equation(const user_thermistor_t &t, const int raw) {
+    // maximum adc value .. take into account the over sampling
+    const int adc_max = MAX_RAW_THERMISTOR_VALUE,
+              adc_raw = constrain(raw, 1, adc_max - 1); // constrain to prevent divide-by-zero
+
+    const float adc_inverse = (adc_max - adc_raw) - 0.5f,
+                resistance = t.series_res * (adc_raw + 0.5f) / adc_inverse,
+                log_resistance = logf(resistance);
+
+    float value = t.sh_alpha;
+    value += log_resistance * t.beta_recip;
+    if (t.sh_c_coeff != 0)
+      value += t.sh_c_coeff * cu(log_resistance);
+    value = 1.0f / value;
+
+    // Return degrees C (up to 999, as the LCD only displays 3 digits)
+    return _MIN(value + THERMISTOR_ABS_ZERO_C, 999);
+  }
+
   float Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const int raw) {
     //#if (MOTHERBOARD == BOARD_RAMPS_14_EFB)
     //  static uint32_t clocks_total = 0;
@@ -1330,21 +1702,10 @@ void Temperature::manage_heater() {
       t.beta_recip   = 1.0f / t.beta;
       t.sh_alpha     = RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
                         - (t.beta_recip * t.res_25_log) - (t.sh_c_coeff * cu(t.res_25_log));
+      TERN_(THERMISTOR_LUT, FILL_THERMISTOR_LUT(user_thermistor_lut[t_index], user_thermistor_equation(t, raw)));
     }
 
-    // maximum adc value .. take into account the over sampling
-    const int adc_max = MAX_RAW_THERMISTOR_VALUE,
-              adc_raw = constrain(raw, 1, adc_max - 1); // constrain to prevent divide-by-zero
-
-    const float adc_inverse = (adc_max - adc_raw) - 0.5f,
-                resistance = t.series_res * (adc_raw + 0.5f) / adc_inverse,
-                log_resistance = logf(resistance);
-
-    float value = t.sh_alpha;
-    value += log_resistance * t.beta_recip;
-    if (t.sh_c_coeff != 0)
-      value += t.sh_c_coeff * cu(log_resistance);
-    value = 1.0f / value;
+    const float value = TERN(THERMISTOR_LUT, user_thermistor_lut[t_index].to_celsius(raw), user_thermistor_equation(t, raw));
 
     //#if (MOTHERBOARD == BOARD_RAMPS_14_EFB)
     //  int32_t clocks = TCNT5 - tcnt5;
@@ -1354,8 +1715,7 @@ void Temperature::manage_heater() {
     //  }
     //#endif
 
-    // Return degrees C (up to 999, as the LCD only displays 3 digits)
-    return _MIN(value + THERMISTOR_ABS_ZERO_C, 999);
+    return value;
   }
 #endif
 
@@ -1467,8 +1827,12 @@ void Temperature::manage_heater() {
 
     #if HOTEND_USES_THERMISTOR
       // Thermistor with conversion table?
-      const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
-      SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      #if ENABLED(THERMISTOR_LUT)
+        return hotend_lut[e].to_celsius(raw);
+      #else
+        const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
+        SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      #endif
     #endif
 
     return 0;
@@ -1482,7 +1846,11 @@ void Temperature::manage_heater() {
     #if ENABLED(HEATER_BED_USER_THERMISTOR)
       return user_thermistor_to_deg_c(CTI_BED, raw);
     #elif ENABLED(HEATER_BED_USES_THERMISTOR)
-      SCAN_THERMISTOR_TABLE(BED_TEMPTABLE, BED_TEMPTABLE_LEN);
+      #if ENABLED(THERMISTOR_LUT)
+        return bed_lut.to_celsius(raw);
+      #else
+        SCAN_THERMISTOR_TABLE(BED_TEMPTABLE, BED_TEMPTABLE_LEN);
+      #endif
     #elif ENABLED(HEATER_BED_USES_AD595)
       return TEMP_AD595(raw);
     #elif ENABLED(HEATER_BED_USES_AD8495)
@@ -1501,7 +1869,11 @@ void Temperature::manage_heater() {
     #if ENABLED(HEATER_CHAMBER_USER_THERMISTOR)
       return user_thermistor_to_deg_c(CTI_CHAMBER, raw);
     #elif ENABLED(HEATER_CHAMBER_USES_THERMISTOR)
-      SCAN_THERMISTOR_TABLE(CHAMBER_TEMPTABLE, CHAMBER_TEMPTABLE_LEN);
+      #if ENABLED(THERMISTOR_LUT)
+        return chamber_lut.to_celsius(raw);
+      #else
+        SCAN_THERMISTOR_TABLE(CHAMBER_TEMPTABLE, CHAMBER_TEMPTABLE_LEN);
+      #endif
     #elif ENABLED(HEATER_CHAMBER_USES_AD595)
       return TEMP_AD595(raw);
     #elif ENABLED(HEATER_CHAMBER_USES_AD8495)
@@ -1520,7 +1892,11 @@ void Temperature::manage_heater() {
     #if ENABLED(PROBE_USER_THERMISTOR)
       return user_thermistor_to_deg_c(CTI_PROBE, raw);
     #elif ENABLED(PROBE_USES_THERMISTOR)
-      SCAN_THERMISTOR_TABLE(PROBE_TEMPTABLE, PROBE_TEMPTABLE_LEN);
+      #if ENABLED(THERMISTOR_LUT)
+        return probe_lut.to_celsius(raw);
+      #else
+        SCAN_THERMISTOR_TABLE(PROBE_TEMPTABLE, PROBE_TEMPTABLE_LEN);
+      #endif
     #elif ENABLED(PROBE_USES_AD595)
       return TEMP_AD595(raw);
     #elif ENABLED(PROBE_USES_AD8495)
@@ -1600,6 +1976,8 @@ void Temperature::updateTemperaturesFromRawValues() {
  */
 void Temperature::init() {
 
+  TERN_(THERMISTOR_LUT, fill_thermistor_luts());
+
   TERN_(MAX6675_IS_MAX31865, max31865.begin(MAX31865_2WIRE)); // MAX31865_2WIRE, MAX31865_3WIRE, MAX31865_4WIRE
 
   #if EARLY_WATCHDOG
@@ -1629,6 +2007,10 @@ void Temperature::init() {
     last_e_position = 0;
   #endif
 
+  #if ENABLED(MPCTEMP)
+    HOTEND_LOOP() resetMPC(e);
+  #endif
+
   #if HAS_HEATER_0
     #ifdef ALFAWISE_UX0
       OUT_WRITE_OD(HEATER_0_PIN, HEATER_0_INVERTING);
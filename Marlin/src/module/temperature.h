@@ -69,6 +69,19 @@ hotend_pid_t;
   typedef IF<(LPQ_MAX_LEN > 255), uint16_t, uint8_t>::type lpq_ptr_t;
 #endif
 
+#if ENABLED(MPCTEMP)
+  // Model Predictive Control storage
+  typedef struct {
+    bool  enabled;                      // M306 S - Use MPC for the hotend, instead of PID or bang-bang
+    float heater_power,                 // M306 P - Heater power (W)
+          block_heat_capacity,          // M306 C - Heater block heat capacity (J/K)
+          sensor_responsiveness,        // M306 R - Rate of change of the sensor temperature per degree from the block (1/s)
+          ambient_xfer_coeff_fan0,      // M306 A - Heat transfer from the block to the air with the fan off (W/K)
+          fan255_adjustment,            // M306 F - Additional heat transfer with the fan on full (W/K)
+          filament_heat_capacity_permm; // M306 H - Heat capacity of the filament per mm of length (J/K/mm)
+  } MPC_t;
+#endif
+
 #define PID_PARAM(F,H) _PID_##F(TERN(PID_PARAMS_PER_HOTEND, H, 0))
 #define _PID_Kp(H) TERN(PIDTEMP, Temperature::temp_hotend[H].pid.Kp, NAN)
 #define _PID_Ki(H) TERN(PIDTEMP, Temperature::temp_hotend[H].pid.Ki, NAN)
@@ -164,6 +177,10 @@ enum ADCSensorState : char {
   #define unscalePID_d(d) ( float(d) * PID_dT )
 #endif
 
+#if ENABLED(MPCTEMP)
+  #define MPC_dT ((OVERSAMPLENR * float(ACTUAL_ADC_SAMPLES)) / TEMP_TIMER_FREQUENCY)
+#endif
+
 #if BOTH(HAS_LCD_MENU, G26_MESH_VALIDATION)
   #define G26_CLICK_CAN_CANCEL 1
 #endif
@@ -190,7 +207,23 @@ struct PIDHeaterInfo : public HeaterInfo {
   T pid;  // Initialized by settings.load()
 };
 
-#if ENABLED(PIDTEMP)
+// A hotend heater with Model Predictive Control, or PID as selected per hotend
+#if ENABLED(MPCTEMP)
+  #if ENABLED(PIDTEMP)
+    struct MPCHeaterInfo : public PIDHeaterInfo<hotend_pid_t> {
+  #else
+    struct MPCHeaterInfo : public HeaterInfo {
+  #endif
+    MPC_t mpc;                // Initialized by settings.load()
+    float modeled_ambient_temp,
+          modeled_block_temp,
+          modeled_sensor_temp;
+  };
+#endif
+
+#if ENABLED(MPCTEMP)
+  typedef struct MPCHeaterInfo hotend_info_t;
+#elif ENABLED(PIDTEMP)
   typedef struct PIDHeaterInfo<hotend_pid_t> hotend_info_t;
 #else
   typedef heater_info_t hotend_info_t;
@@ -432,6 +465,7 @@ class Temperature {
         //if (!WITHIN(t_index, 0, USER_THERMISTORS - 1)) return false;
         if (!WITHIN(value, 1, 1000000)) return false;
         user_thermistor[t_index].series_res = value;
+        TERN_(THERMISTOR_LUT, user_thermistor[t_index].pre_calc = true);
         return true;
       }
       static bool set_res25(int8_t t_index, float value) {
@@ -739,6 +773,20 @@ class Temperature {
 
     #endif
 
+    #if ENABLED(MPCTEMP)
+      static void log_mpc(const uint8_t e, const bool eprom=false);
+
+      /**
+       * Measure the model constants of a hotend in response to M306 T
+       */
+      static void MPC_autotune(const uint8_t e);
+
+      /**
+       * Restart the model from the measured temperature, as after a change of constants
+       */
+      FORCE_INLINE static void resetMPC(const uint8_t E_NAME) { temp_hotend[HOTEND_INDEX].modeled_block_temp = NAN; }
+    #endif
+
     #if ENABLED(PROBING_HEATERS_OFF)
       static void pause(const bool p);
       FORCE_INLINE static bool is_paused() { return paused; }
@@ -807,6 +855,8 @@ class Temperature {
 
     static float get_pid_output_hotend(const uint8_t e);
 
+    TERN_(MPCTEMP, static float get_mpc_output_hotend(const uint8_t e));
+
     TERN_(PIDTEMPBED, static float get_pid_output_bed());
 
     TERN_(HAS_HEATED_CHAMBER, static float get_pid_output_chamber());
@@ -32,6 +32,11 @@
 #endif
 #define MAX_RAW_THERMISTOR_VALUE (HAL_ADC_RANGE * (OVERSAMPLENR) - 1)
 
+#if ENABLED(THERMISTOR_LUT)
+  // Raw readings per lookup table interval, as a power of 2
+  #define THERMISTOR_LUT_SHIFT ((HAL_ADC_RESOLUTION) + ((OVERSAMPLENR) == 16 ? 4 : 0) - (THERMISTOR_LUT_BITS))
+#endif
+
 // Currently Marlin stores all oversampled ADC values as int16_t, make sure the HAL settings do not overflow 15bit
 #if MAX_RAW_THERMISTOR_VALUE > ((1 << 15) - 1)
   #error "MAX_RAW_THERMISTOR_VALUE is too large for int16_t. Reduce OVERSAMPLENR or HAL_ADC_RESOLUTION."
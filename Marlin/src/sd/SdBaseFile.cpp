@@ -1060,6 +1060,37 @@ int16_t SdBaseFile::read(void* buf, uint16_t nbyte) {
   return nbyte;
 }
 
+#if ENABLED(SD_BLOCK_CACHE)
+
+  /**
+   * Read one of the next SD_CACHE_DATA_LINES blocks after the current
+   * position into the volume cache, so read() finds it in RAM. The FAT
+   * lookup for the next cluster is also done here, ahead of time.
+   * Intended for idle time, so it reads at most one block per call.
+   *
+   * \return true if a block was read from the card. false if the blocks
+   * ahead are already cached, at end of file, or if an error occurs.
+   */
+  bool SdBaseFile::prefetch() {
+    if (!isFile() || !(flags_ & O_READ)) return false;
+
+    // curCluster_ is the cluster of the last byte read, or unset at the start of the file
+    const uint8_t shift = 9 + vol_->clusterSizeShift();
+    uint32_t cluster = curPosition_ ? curCluster_ : firstCluster_,
+             index = curPosition_ ? (curPosition_ - 1) >> shift : 0;
+
+    const uint32_t end = (curPosition_ & ~0x1FFUL) + SD_CACHE_DATA_LINES * 512UL;
+    for (uint32_t pos = curPosition_ & ~0x1FFUL; pos < end && pos < fileSize_; pos += 512) {
+      for (; index < (pos >> shift); index++)
+        if (!vol_->fatGet(cluster, &cluster) || vol_->isEOC(cluster)) return false;
+      const uint32_t block = vol_->blockNumber(cluster, pos);
+      if (!vol_->cacheHolds(block)) return vol_->cachePrefetch(block);
+    }
+    return false;
+  }
+
+#endif
+
 /**
  * Read the next entry in a directory.
  *
@@ -296,6 +296,9 @@ class SdBaseFile {
   bool openNext(SdBaseFile* dirFile, uint8_t oflag);
   bool openRoot(SdVolume* vol);
   int peek();
+  #if ENABLED(SD_BLOCK_CACHE)
+    bool prefetch();
+  #endif
   static void printFatDate(uint16_t fatDate);
   static void printFatTime(uint16_t fatTime);
   bool printName();
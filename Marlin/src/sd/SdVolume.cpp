@@ -42,6 +42,10 @@
   Sd2Card* SdVolume::sdCard_;            // pointer to SD card object
   bool     SdVolume::cacheDirty_;        // cacheFlush() will write block if true
   uint32_t SdVolume::cacheMirrorBlock_;  // mirror  block for second FAT
+  #if ENABLED(SD_BLOCK_CACHE)
+    cache_line_t SdVolume::fatLines_[SD_CACHE_FAT_LINES];   // FAT blocks
+    cache_line_t SdVolume::dataLines_[SD_CACHE_DATA_LINES]; // prefetched file data
+  #endif
 #endif  // USE_MULTIPLE_CARDS
 
 // find a contiguous group of clusters
@@ -123,6 +127,7 @@ bool SdVolume::cacheFlush() {
     if (cacheDirty_) {
       if (!sdCard_->writeBlock(cacheBlockNumber_, cacheBuffer_.data))
         return false;
+      TERN_(SD_BLOCK_CACHE, cacheInvalidate(cacheBlockNumber_));
 
       // mirror FAT tables
       if (cacheMirrorBlock_) {
@@ -139,13 +144,103 @@ bool SdVolume::cacheFlush() {
 bool SdVolume::cacheRawBlock(uint32_t blockNumber, bool dirty) {
   if (cacheBlockNumber_ != blockNumber) {
     if (!cacheFlush()) return false;
-    if (!sdCard_->readBlock(blockNumber, cacheBuffer_.data)) return false;
+    if (!TERN(SD_BLOCK_CACHE, cacheRead, sdCard_->readBlock)(blockNumber, cacheBuffer_.data)) return false;
     cacheBlockNumber_ = blockNumber;
   }
   if (dirty) cacheDirty_ = true;
   return true;
 }
 
+#if ENABLED(SD_BLOCK_CACHE)
+
+  /**
+   * Cache lines are kept in least recently used order by 'age', which is
+   * always a permutation of 0..count-1. The oldest line is refilled next.
+   */
+  static cache_line_t* lineFind(cache_line_t lines[], const uint8_t count, const uint32_t blockNumber) {
+    LOOP_L_N(i, count) if (lines[i].blockNumber == blockNumber) return &lines[i];
+    return nullptr;
+  }
+
+  static cache_line_t* lineOldest(cache_line_t lines[], const uint8_t count) {
+    LOOP_L_N(i, count) if (lines[i].age == count - 1) return &lines[i];
+    return &lines[0];
+  }
+
+  // Make a line the most recently used
+  static void lineTouch(cache_line_t lines[], const uint8_t count, cache_line_t * const line) {
+    LOOP_L_N(i, count) if (lines[i].age < line->age) lines[i].age++;
+    line->age = 0;
+  }
+
+  // Empty a line and make it the next to be refilled
+  static void lineDrop(cache_line_t lines[], const uint8_t count, cache_line_t * const line) {
+    LOOP_L_N(i, count) if (lines[i].age > line->age) lines[i].age--;
+    line->age = count - 1;
+    line->blockNumber = 0xFFFFFFFF;
+  }
+
+  void SdVolume::cacheLinesReset() {
+    LOOP_L_N(i, SD_CACHE_FAT_LINES) { fatLines_[i].blockNumber = 0xFFFFFFFF; fatLines_[i].age = i; }
+    LOOP_L_N(i, SD_CACHE_DATA_LINES) { dataLines_[i].blockNumber = 0xFFFFFFFF; dataLines_[i].age = i; }
+  }
+
+  // Forget a block that is being written to the card
+  void SdVolume::cacheInvalidate(const uint32_t blockNumber) {
+    cache_line_t *line = lineFind(fatLines_, SD_CACHE_FAT_LINES, blockNumber);
+    if (line) lineDrop(fatLines_, SD_CACHE_FAT_LINES, line);
+    line = lineFind(dataLines_, SD_CACHE_DATA_LINES, blockNumber);
+    if (line) lineDrop(dataLines_, SD_CACHE_DATA_LINES, line);
+  }
+
+  // Read a block from a cache line if there is one, else from the card.
+  // File data is only read once, so a data line is freed as it's used.
+  bool SdVolume::cacheRead(const uint32_t blockNumber, uint8_t * const dst) {
+    cache_line_t *line = lineFind(dataLines_, SD_CACHE_DATA_LINES, blockNumber);
+    if (line) {
+      memcpy(dst, line->buffer.data, 512);
+      lineDrop(dataLines_, SD_CACHE_DATA_LINES, line);
+      return true;
+    }
+    line = lineFind(fatLines_, SD_CACHE_FAT_LINES, blockNumber);
+    if (line) {
+      memcpy(dst, line->buffer.data, 512);
+      return true;
+    }
+    return sdCard_->readBlock(blockNumber, dst);
+  }
+
+  // A FAT block to read entries from. The main cache takes precedence
+  // since it may hold changes not yet written to the card.
+  cache_t* SdVolume::fatBlock(const uint32_t blockNumber) {
+    if (blockNumber == cacheBlockNumber_) return &cacheBuffer_;
+    cache_line_t *line = lineFind(fatLines_, SD_CACHE_FAT_LINES, blockNumber);
+    if (!line) {
+      line = lineOldest(fatLines_, SD_CACHE_FAT_LINES);
+      line->blockNumber = 0xFFFFFFFF;
+      if (!sdCard_->readBlock(blockNumber, line->buffer.data)) return nullptr;
+      line->blockNumber = blockNumber;
+    }
+    lineTouch(fatLines_, SD_CACHE_FAT_LINES, line);
+    return &line->buffer;
+  }
+
+  bool SdVolume::cacheHolds(const uint32_t blockNumber) {
+    return blockNumber == cacheBlockNumber_ || lineFind(dataLines_, SD_CACHE_DATA_LINES, blockNumber);
+  }
+
+  // Read a file data block into the oldest data line
+  bool SdVolume::cachePrefetch(const uint32_t blockNumber) {
+    cache_line_t * const line = lineOldest(dataLines_, SD_CACHE_DATA_LINES);
+    line->blockNumber = 0xFFFFFFFF;
+    if (!sdCard_->readBlock(blockNumber, line->buffer.data)) return false;
+    line->blockNumber = blockNumber;
+    lineTouch(dataLines_, SD_CACHE_DATA_LINES, line);
+    return true;
+  }
+
+#endif // SD_BLOCK_CACHE
+
 // return the size in bytes of a cluster chain
 bool SdVolume::chainSize(uint32_t cluster, uint32_t* size) {
   uint32_t s = 0;
@@ -185,10 +280,16 @@ bool SdVolume::fatGet(uint32_t cluster, uint32_t* value) {
   else
     return false;
 
-  if (lba != cacheBlockNumber_ && !cacheRawBlock(lba, CACHE_FOR_READ))
-    return false;
+  #if ENABLED(SD_BLOCK_CACHE)
+    const cache_t * const fat = fatBlock(lba);
+    if (!fat) return false;
+  #else
+    if (lba != cacheBlockNumber_ && !cacheRawBlock(lba, CACHE_FOR_READ))
+      return false;
+    const cache_t * const fat = &cacheBuffer_;
+  #endif
 
-  *value = (fatType_ == 16) ? cacheBuffer_.fat16[cluster & 0xFF] : (cacheBuffer_.fat32[cluster & 0x7F] & FAT32MASK);
+  *value = (fatType_ == 16) ? fat->fat16[cluster & 0xFF] : (fat->fat32[cluster & 0x7F] & FAT32MASK);
   return true;
 }
 
@@ -334,6 +435,7 @@ bool SdVolume::init(Sd2Card* dev, uint8_t part) {
   cacheDirty_ = 0;  // cacheFlush() will write block if true
   cacheMirrorBlock_ = 0;
   cacheBlockNumber_ = 0xFFFFFFFF;
+  TERN_(SD_BLOCK_CACHE, cacheLinesReset());
 
   // if part == 0 assume super floppy with FAT boot sector in block zero
   // if part > 0 assume mbr volume with partition table
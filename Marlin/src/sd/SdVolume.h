@@ -64,6 +64,17 @@ union cache_t {
   fat32_fsinfo_t  fsinfo;     // Used to access to a cached FAT32 FSINFO sector.
 };
 
+#if ENABLED(SD_BLOCK_CACHE)
+  /**
+   * \brief A read-only block held next to the main cache
+   */
+  struct cache_line_t {
+    uint32_t blockNumber;       // Logical block number, 0xFFFFFFFF if unused
+    uint8_t age;                // 0 for the most recently used line
+    cache_t buffer;
+  };
+#endif
+
 /**
  * \class SdVolume
  * \brief Access FAT16 and FAT32 volumes on SD and SDHC cards.
@@ -80,6 +91,7 @@ class SdVolume {
   cache_t* cacheClear() {
     if (!cacheFlush()) return 0;
     cacheBlockNumber_ = 0xFFFFFFFF;
+    TERN_(SD_BLOCK_CACHE, cacheLinesReset());
     return &cacheBuffer_;
   }
 
@@ -144,12 +156,20 @@ class SdVolume {
     Sd2Card* sdCard_;            // Sd2Card object for cache
     bool cacheDirty_;            // cacheFlush() will write block if true
     uint32_t cacheMirrorBlock_;  // block number for mirror FAT
+    #if ENABLED(SD_BLOCK_CACHE)
+      cache_line_t fatLines_[SD_CACHE_FAT_LINES];   // FAT blocks, least recently used goes first
+      cache_line_t dataLines_[SD_CACHE_DATA_LINES]; // File data read ahead by SdBaseFile::prefetch()
+    #endif
   #else
     static cache_t cacheBuffer_;        // 512 byte cache for device blocks
     static uint32_t cacheBlockNumber_;  // Logical number of block in the cache
     static Sd2Card* sdCard_;            // Sd2Card object for cache
     static bool cacheDirty_;            // cacheFlush() will write block if true
     static uint32_t cacheMirrorBlock_;  // block number for mirror FAT
+    #if ENABLED(SD_BLOCK_CACHE)
+      static cache_line_t fatLines_[SD_CACHE_FAT_LINES];   // FAT blocks, least recently used goes first
+      static cache_line_t dataLines_[SD_CACHE_DATA_LINES]; // File data read ahead by SdBaseFile::prefetch()
+    #endif
   #endif
 
   uint32_t allocSearchStart_;   // start cluster for alloc search
@@ -175,9 +195,25 @@ class SdVolume {
   #if USE_MULTIPLE_CARDS
     bool cacheFlush();
     bool cacheRawBlock(uint32_t blockNumber, bool dirty);
+    #if ENABLED(SD_BLOCK_CACHE)
+      void cacheLinesReset();
+      void cacheInvalidate(uint32_t blockNumber);
+      bool cacheRead(uint32_t blockNumber, uint8_t* dst);
+    #endif
   #else
     static bool cacheFlush();
     static bool cacheRawBlock(uint32_t blockNumber, bool dirty);
+    #if ENABLED(SD_BLOCK_CACHE)
+      static void cacheLinesReset();
+      static void cacheInvalidate(uint32_t blockNumber);
+      static bool cacheRead(uint32_t blockNumber, uint8_t* dst);
+    #endif
+  #endif
+
+  #if ENABLED(SD_BLOCK_CACHE)
+    cache_t* fatBlock(uint32_t blockNumber);
+    bool cacheHolds(uint32_t blockNumber);
+    bool cachePrefetch(uint32_t blockNumber);
   #endif
 
   // used by SdBaseFile write to assign cache to SD location
@@ -196,6 +232,9 @@ class SdVolume {
     if (fatType_ == 16) return cluster >= FAT16EOC_MIN;
     return  cluster >= FAT32EOC_MIN;
   }
-  bool readBlock(uint32_t block, uint8_t* dst) { return sdCard_->readBlock(block, dst); }
-  bool writeBlock(uint32_t block, const uint8_t* dst) { return sdCard_->writeBlock(block, dst); }
+  bool readBlock(uint32_t block, uint8_t* dst) { return TERN(SD_BLOCK_CACHE, cacheRead(block, dst), sdCard_->readBlock(block, dst)); }
+  bool writeBlock(uint32_t block, const uint8_t* dst) {
+    TERN_(SD_BLOCK_CACHE, cacheInvalidate(block));
+    return sdCard_->writeBlock(block, dst);
+  }
 };
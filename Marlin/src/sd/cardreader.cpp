@@ -123,6 +123,12 @@ char CardReader::proc_filenames[SD_PROCEDURE_DEPTH][MAXPATHNAMELENGTH];
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SD_READ_AHEAD)
+  uint8_t CardReader::read_ahead[SD_READ_AHEAD_SIZE];
+  uint32_t CardReader::read_ahead_pos;
+  uint16_t CardReader::read_ahead_count, CardReader::read_ahead_index;
+#endif
+
 CardReader::CardReader() {
   #if ENABLED(SDCARD_SORT_ALPHA)
     sort_count = 0;
@@ -578,6 +584,7 @@ void CardReader::openFileRead(char * const path, const uint8_t subcall_type/*=0*
   if (file.open(curDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    TERN_(SD_READ_AHEAD, discard_read_ahead());
 
     PORT_REDIRECT(SERIAL_BOTH);
     SERIAL_ECHOLNPAIR(STR_SD_FILE_OPENED, fname, STR_SD_SIZE, filesize);
@@ -721,6 +728,7 @@ void CardReader::closefile(const bool store_location) {
   file.close();
   flag.saving = flag.logging = false;
   sdpos = 0;
+  TERN_(SD_READ_AHEAD, discard_read_ahead());
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
   if (store_location) {
@@ -729,6 +737,26 @@ void CardReader::closefile(const bool store_location) {
   }
 }
 
+#if ENABLED(SD_READ_AHEAD)
+
+  //
+  // Refill the read-ahead buffer when it's used up. Reads end on a block
+  // boundary so whole 512-byte blocks go straight from the card to the buffer.
+  //
+  uint16_t CardReader::buffered(const char* &data) {
+    if (read_ahead_index >= read_ahead_count) {
+      read_ahead_pos = file.curPosition();
+      read_ahead_index = 0;
+      const int16_t n = file.read(read_ahead, SD_READ_AHEAD_SIZE - (read_ahead_pos & 0x1FF));
+      read_ahead_count = n > 0 ? n : 0;
+      if (!read_ahead_count) { sdpos = read_ahead_pos; return 0; } // End of file or read error
+    }
+    data = (const char*)&read_ahead[read_ahead_index];
+    return read_ahead_count - read_ahead_index;
+  }
+
+#endif
+
 //
 // Get info for a file in the working directory by index
 //
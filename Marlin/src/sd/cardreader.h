@@ -86,6 +86,11 @@ public:
   // Handle media insert/remove
   static void manage_media();
 
+  #if ENABLED(SD_BLOCK_CACHE)
+    // Read the file being printed ahead into the block cache
+    static inline void prefetch() { if (flag.sdprinting) file.prefetch(); }
+  #endif
+
   // SD Card Logging
   static void openLogFile(char * const path);
   static void write_command(char * const buf);
@@ -158,10 +163,41 @@ public:
   static inline uint32_t getIndex() { return sdpos; }
   static inline uint32_t getFileSize() { return filesize; }
   static inline bool eof() { return sdpos >= filesize; }
-  static inline void setIndex(const uint32_t index) { sdpos = index; file.seekSet(index); }
   static inline char* getWorkDirName() { workDir.getDosName(filename); return filename; }
-  static inline int16_t get() { sdpos = file.curPosition(); return (int16_t)file.read(); }
-  static inline int16_t read(void* buf, uint16_t nbyte) { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+
+  #if ENABLED(SD_READ_AHEAD)
+    static inline void setIndex(const uint32_t index) { discard_read_ahead(); sdpos = index; file.seekSet(index); }
+
+    /**
+     * Read the file through a multi-block buffer. sdpos is still the index of
+     * the last byte handed out, the same as with unbuffered get(), so power-loss
+     * recovery positions stay exact.
+     *
+     * buffered() points 'data' at the bytes waiting at the read position and
+     * returns their count, refilling as needed. Zero means end of file or a
+     * read error (check eof()). consume() hands out bytes from the buffer.
+     */
+    static uint16_t buffered(const char* &data);
+    static inline void consume(const uint16_t n) { read_ahead_index += n; sdpos = read_ahead_pos + read_ahead_index - 1; }
+
+    static inline int16_t get() {
+      const char *data;
+      if (!buffered(data)) return -1;
+      consume(1);
+      return (uint8_t)*data;
+    }
+
+    static inline int16_t read(void* buf, uint16_t nbyte) {
+      if (!file.isOpen()) return -1;
+      if (read_ahead_index < read_ahead_count) file.seekSet(read_ahead_pos + read_ahead_index);
+      discard_read_ahead();
+      return file.read(buf, nbyte);
+    }
+  #else
+    static inline void setIndex(const uint32_t index) { sdpos = index; file.seekSet(index); }
+    static inline int16_t get() { sdpos = file.curPosition(); return (int16_t)file.read(); }
+    static inline int16_t read(void* buf, uint16_t nbyte) { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+  #endif
   static inline int16_t write(void* buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
 
   static Sd2Card& getSd2Card() { return sd2card; }
@@ -245,6 +281,13 @@ private:
 
   static uint32_t filesize, sdpos;
 
+  #if ENABLED(SD_READ_AHEAD)
+    static uint8_t read_ahead[SD_READ_AHEAD_SIZE];
+    static uint32_t read_ahead_pos;                   // File position of read_ahead[0]
+    static uint16_t read_ahead_count, read_ahead_index;
+    static inline void discard_read_ahead() { read_ahead_count = read_ahead_index = 0; }
+  #endif
+
   //
   // Procedure calls to other files
   //
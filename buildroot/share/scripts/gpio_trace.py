@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""Linux simulator GPIO trace converter
+
+Converts the binary trace written by the Linux HAL simulator
+(marlin --gpio-trace <file>) into CSV or into a VCD file for
+waveform viewers such as GTKWave.
+
+Usage: gpio_trace.py [options] trace.bin
+
+Options:
+  -h, --help          show this help
+  --csv=FILE          write "timestamp, pin, event, value" lines ('-' for stdout)
+  --vcd=FILE          write a Value Change Dump
+  --pins=LIST         only these pins, optionally named, e.g. 54=X_STEP,55=X_DIR,38
+
+With no output option a summary of the trace is printed.
+"""
+
+from __future__ import print_function
+
+import argparse
+import struct
+import sys
+
+MAGIC = b'MRLNGPIO'
+HEADER = struct.Struct('<8sII')
+RECORD = struct.Struct('<QhBxI')
+VERSION = 2
+
+# GpioEvent::Type, plus the GpioTrace markers
+NOP, FALL, RISE, SET_VALUE, SETM, SETD = range(6)
+BLOCK, ISR_OVERRUN, OVERFLOW = 0xFD, 0xFE, 0xFF
+EVENT_NAMES = { NOP: 'NOP', FALL: 'FALL', RISE: 'RISE', SET_VALUE: 'SET_VALUE', SETM: 'SETM', SETD: 'SETD',
+                BLOCK: 'BLOCK', ISR_OVERRUN: 'ISR_OVERRUN', OVERFLOW: 'OVERFLOW' }
+
+# GpioTrace::BlockField, the 'pin' of each BLOCK record
+BLOCK_FIELDS = ('step_event_count', 'initial_rate', 'nominal_rate', 'final_rate',
+                'accelerate_until', 'decelerate_after', 'acceleration',
+                'steps_a', 'steps_b', 'steps_c', 'steps_e', 'direction_bits')
+
+def read_trace(path):
+    """Return the trace records as (timestamp, pin, event, value) tuples in time order."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if len(data) < HEADER.size:
+        raise ValueError('%s: too short for a GPIO trace' % path)
+    magic, version, record_size = HEADER.unpack_from(data)
+    if magic != MAGIC:
+        raise ValueError('%s: not a GPIO trace' % path)
+    if version != VERSION or record_size != RECORD.size:
+        raise ValueError('%s: unsupported trace version %d' % (path, version))
+    end = HEADER.size + (len(data) - HEADER.size) // RECORD.size * RECORD.size
+    records = list(RECORD.iter_unpack(data[HEADER.size:end]))
+    # Each producer thread is written in batches, so merge by time (stable)
+    records.sort(key=lambda r: r[0])
+    return records
+
+def parse_pins(spec):
+    """'54=X_STEP,38' -> {54: 'X_STEP', 38: 'pin38'}"""
+    pins = {}
+    for item in spec.split(','):
+        if not item: continue
+        num, _, name = item.partition('=')
+        pins[int(num)] = name or 'pin%s' % num
+    return pins
+
+def write_csv(records, out):
+    for ts, pin, event, value in records:
+        out.write('%d, %d, %s, %d\n' % (ts, pin, EVENT_NAMES.get(event, event), value))
+
+def vcd_id(n):
+    """Short printable VCD identifier for signal n."""
+    chars = ''
+    n += 1
+    while n:
+        n, r = divmod(n - 1, 94)
+        chars += chr(33 + r)
+    return chars
+
+def write_vcd(records, out, names):
+    # Pins only ever driven with 0/1 become wires, the rest 16-bit vectors
+    value_events = [r for r in records if r[2] in (NOP, FALL, RISE, SET_VALUE)]
+    pins = sorted(set(r[1] for r in value_events))
+    wide = set(r[1] for r in value_events if r[2] == SET_VALUE or r[3] > 1)
+    ids = dict((pin, vcd_id(i)) for i, pin in enumerate(pins))
+
+    out.write('$timescale 1ns $end\n$scope module marlin $end\n')
+    for pin in pins:
+        out.write('$var %s %d %s %s $end\n' % ('reg' if pin in wide else 'wire', 16 if pin in wide else 1, ids[pin], names.get(pin, 'pin%d' % pin)))
+    out.write('$upscope $end\n$enddefinitions $end\n')
+
+    last_ts, last_value = None, {}
+    for ts, pin, event, value in value_events:
+        if last_value.get(pin) == value: continue
+        last_value[pin] = value
+        if ts != last_ts:
+            out.write('#%d\n' % ts)
+            last_ts = ts
+        if pin in wide:
+            out.write('b%s %s\n' % (format(value, 'b'), ids[pin]))
+        else:
+            out.write('%d%s\n' % (value & 1, ids[pin]))
+
+def summary(records, names):
+    if not records:
+        print('Empty trace')
+        return
+    lost = sum(r[3] for r in records if r[2] == OVERFLOW)
+    print('%d events over %.6f s' % (len(records), (records[-1][0] - records[0][0]) / 1e9))
+    if lost: print('%d events lost to overflow' % lost)
+    counts = {}
+    blocks = overruns = 0
+    for ts, pin, event, value in records:
+        if event == RISE: counts[pin] = counts.get(pin, 0) + 1
+        elif event == BLOCK and pin == 0: blocks += 1
+        elif event == ISR_OVERRUN: overruns += 1
+    if blocks: print('%d blocks, %d stepper ISR overruns' % (blocks, overruns))
+    for pin in sorted(counts):
+        print('  %-10s %d rising edges' % (names.get(pin, 'pin%d' % pin), counts[pin]))
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='Convert a Linux simulator GPIO trace to CSV or VCD.')
+    parser.add_argument('trace')
+    parser.add_argument('--csv', help="CSV output file, '-' for stdout")
+    parser.add_argument('--vcd', help='VCD output file')
+    parser.add_argument('--pins', default='', help='pins to keep, optionally named: 54=X_STEP,55=X_DIR')
+    args = parser.parse_args(argv)
+
+    records = read_trace(args.trace)
+    names = parse_pins(args.pins)
+    if names:
+        records = [r for r in records if r[1] in names or r[2] >= BLOCK]
+
+    if args.csv == '-':
+        write_csv(records, sys.stdout)
+    elif args.csv:
+        with open(args.csv, 'w') as out:
+            write_csv(records, out)
+    if args.vcd:
+        with open(args.vcd, 'w') as out:
+            write_vcd(records, out, names)
+    if not (args.csv or args.vcd):
+        summary(records, names)
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""Planner output comparison for the Linux simulator
+
+Compares the blocks planned in two GPIO traces recorded with
+'marlin --virtual-time --gpio-trace <file>' running the same G-code,
+e.g. a build with PLANNER_FIXED_POINT against one without it.
+
+Every block must have the same steps and directions. The trapezoid fields
+may differ by a few counts of rounding:
+
+  --rate-tolerance=N  initial_rate, nominal_rate, final_rate (default: 1 step/s)
+  --step-tolerance=N  accelerate_until, decelerate_after (default: 2 steps)
+
+The largest difference seen for each field is printed.
+
+Usage: plan_compare.py [options] reference.bin test.bin
+
+Exits with status 1 if the traces don't match within the tolerances.
+"""
+
+from __future__ import print_function
+
+import argparse
+import sys
+
+import gpio_trace as gt
+
+RATE_FIELDS = ('initial_rate', 'nominal_rate', 'final_rate')
+STEP_FIELDS = ('accelerate_until', 'decelerate_after')
+
+def read_blocks(path):
+    """Return the blocks of a trace as dicts of BLOCK_FIELDS."""
+    blocks = []
+    for ts, pin, event, value in gt.read_trace(path):
+        if event != gt.BLOCK: continue
+        if pin == 0: blocks.append({})
+        if blocks and pin < len(gt.BLOCK_FIELDS): blocks[-1][gt.BLOCK_FIELDS[pin]] = value
+    return blocks
+
+def compare(ref, test, tolerance):
+    failed = False
+    if len(ref) != len(test):
+        print('Block count differs: %d vs %d' % (len(ref), len(test)))
+        failed = True
+
+    worst = dict((field, (0, None)) for field in gt.BLOCK_FIELDS)
+    for i, (a, b) in enumerate(zip(ref, test)):
+        for field in gt.BLOCK_FIELDS:
+            diff = abs(a.get(field, 0) - b.get(field, 0))
+            if diff > worst[field][0]: worst[field] = (diff, i)
+            if diff > tolerance.get(field, 0):
+                if not failed: print('Block %d: %s %d vs %d' % (i, field, a.get(field, 0), b.get(field, 0)))
+                failed = True
+
+    print('%d blocks compared' % min(len(ref), len(test)))
+    for field in gt.BLOCK_FIELDS:
+        diff, i = worst[field]
+        print('  %-18s max difference %d' % (field, diff) + (' (block %d)' % i if diff else ''))
+    print('MISMATCH' if failed else 'OK')
+    return failed
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='Compare the planned blocks in two Linux simulator GPIO traces.')
+    parser.add_argument('reference')
+    parser.add_argument('test')
+    parser.add_argument('--rate-tolerance', type=int, default=1, help='allowed step rate difference in steps/s')
+    parser.add_argument('--step-tolerance', type=int, default=2, help='allowed trapezoid point difference in steps')
+    args = parser.parse_args(argv)
+
+    tolerance = dict((field, args.rate_tolerance) for field in RATE_FIELDS)
+    tolerance.update((field, args.step_tolerance) for field in STEP_FIELDS)
+    return 1 if compare(read_blocks(args.reference), read_blocks(args.test), tolerance) else 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""Planner and stepper benchmark for the Linux simulator
+
+Replays G-code files through a Linux native build ('marlin --bench') in
+virtual time and tabulates, per file:
+
+  - planner host time per block (mean and p99)
+  - underruns, where the planner ran dry and the stepper waited for a block
+  - stepper ISR host time (mean, p99 and max)
+  - blocks per simulated and per host second
+
+With no files a built-in corpus is generated: short segments, a vase-mode
+spiral of tiny moves and G2/G3 arcs (the last needs ARC_SUPPORT). Compare
+builds with different BLOCK_BUFFER_SIZE, MIN_STEPS_PER_SEGMENT or junction
+deviation settings by running the same corpus through each.
+
+Planning takes no simulated time unless --scale is given. Then the planner's
+host time, times the scale, is charged to the simulated clock, as on a board
+that many times slower than the host, and underruns show where it falls behind.
+
+Usage: planner_bench.py [options] [file.gcode ...]
+
+Options:
+  --marlin=PATH       the simulator binary (default: .pio/build/linux_native/program)
+  --center=X,Y        center of the generated moves (default: 0,0 for a delta)
+  --scale=X           charge the planner's host time times X to the simulated clock
+  --write-corpus=DIR  save the generated corpus and exit
+"""
+
+from __future__ import print_function, division
+
+import argparse
+import math
+import os
+import subprocess
+import sys
+import tempfile
+
+HEADER = 'M302 P1\nG28\nG1 Z20 F3000\nG92 E0\n'
+FOOTER = 'M400\n'
+
+def segments(cx, cy):
+    """Circles of 0.5 mm chords, like a sliced perimeter."""
+    lines, e = [], 0
+    for layer in range(3):
+        lines.append('G1 Z%.2f F3000' % (0.2 + layer * 0.2))
+        for r in (30, 20, 10):
+            n = int(2 * math.pi * r / 0.5)
+            for i in range(n + 1):
+                a = 2 * math.pi * i / n
+                e += 0.02
+                lines.append('G1 X%.3f Y%.3f E%.4f F3000' % (cx + r * math.cos(a), cy + r * math.sin(a), e))
+    return lines
+
+def vase(cx, cy):
+    """A spiral of 0.1 mm moves, rising continuously, as in vase mode."""
+    lines, e, r, step = [], 0, 25, 0.1
+    n = int(2 * math.pi * r / step)
+    for i in range(10 * n):
+        a = 2 * math.pi * i / n
+        e += 0.004
+        lines.append('G1 X%.3f Y%.3f Z%.4f E%.4f F2400' % (cx + r * math.cos(a), cy + r * math.sin(a), 0.2 + 0.2 * i / n, e))
+    return lines
+
+def arcs(cx, cy):
+    """Full circles and quarter arcs of several radii."""
+    lines = ['G1 Z0.2 F3000']
+    for r in (2, 5, 10, 20, 30):
+        lines.append('G1 X%.3f Y%.3f F6000' % (cx + r, cy))
+        lines.append('G2 X%.3f Y%.3f I%.3f J0 F3000' % (cx + r, cy, -r))
+        lines.append('G3 X%.3f Y%.3f I%.3f J0 F3000' % (cx + r, cy, -r))
+        for q in range(4): # clockwise, a quarter at a time
+            a0, a1 = -math.pi / 2 * q, -math.pi / 2 * (q + 1)
+            lines.append('G2 X%.3f Y%.3f I%.3f J%.3f F4000' % (cx + r * math.cos(a1), cy + r * math.sin(a1),
+                                                             -r * math.cos(a0), -r * math.sin(a0)))
+    return lines
+
+CORPUS = (('segments', segments), ('vase', vase), ('arcs', arcs))
+
+def write_corpus(directory, cx, cy):
+    paths = []
+    for name, gen in CORPUS:
+        path = os.path.join(directory, name + '.gcode')
+        with open(path, 'w') as f:
+            f.write(HEADER + '\n'.join(gen(cx, cy)) + '\n' + FOOTER)
+        paths.append(path)
+    return paths
+
+def run(marlin, path, scale):
+    """Run one file, returning the values of the BENCH line as a dict."""
+    with open(path, 'rb') as gcode:
+        proc = subprocess.run([marlin, '--bench-scale', str(scale)], stdin=gcode, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+    for line in proc.stderr.decode(errors='replace').splitlines():
+        if line.startswith('BENCH '):
+            return dict((k, float(v)) for k, v in (item.split('=') for item in line.split()[1:]))
+    raise RuntimeError('%s: no benchmark report (exit status %d)' % (path, proc.returncode))
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='Benchmark the planner and stepper on the Linux simulator.')
+    parser.add_argument('files', nargs='*')
+    parser.add_argument('--marlin', default='.pio/build/linux_native/program')
+    parser.add_argument('--center', default='0,0')
+    parser.add_argument('--scale', type=float, default=0)
+    parser.add_argument('--write-corpus')
+    args = parser.parse_args(argv)
+
+    cx, cy = (float(v) for v in args.center.split(','))
+    if args.write_corpus:
+        os.makedirs(args.write_corpus, exist_ok=True)
+        for path in write_corpus(args.write_corpus, cx, cy): print(path)
+        return 0
+
+    with tempfile.TemporaryDirectory() as tmp:
+        files = args.files or write_corpus(tmp, cx, cy)
+        print('%-12s %8s %9s %8s %11s %11s %9s %9s %9s %9s %9s' % ('file', 'blocks', 'sim s', 'host s',
+              'plan ns', 'plan p99', 'underrun', 'isr ns', 'isr p99', 'isr max', 'blocks/s'))
+        failed = False
+        for path in files:
+            name = os.path.splitext(os.path.basename(path))[0]
+            try:
+                r = run(args.marlin, path, args.scale)
+            except (OSError, RuntimeError) as err:
+                print('%-12s %s' % (name, err))
+                failed = True
+                continue
+            print('%-12s %8d %9.3f %8.3f %11d %11d %9d %9d %9d %9d %9.0f' % (name, r['blocks'], r['sim_s'], r['host_s'],
+                  r['plan_ns_mean'], r['plan_ns_p99'], r['underruns'], r['isr_ns_mean'], r['isr_ns_p99'], r['isr_ns_max'],
+                  r['blocks'] / r['sim_s'] if r['sim_s'] else 0))
+    return 1 if failed else 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
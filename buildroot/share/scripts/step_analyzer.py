@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+"""Step pulse timing analyzer for the Linux simulator
+
+Reads a GPIO trace recorded with 'marlin --gpio-trace <file>' (preferably
+also with --virtual-time for reproducible timing) and reports, per axis:
+
+  - a histogram of step rates
+  - the step interval error against the planned trapezoid of each block,
+    for the lead axis and for the slower axes of multi-axis moves
+  - step pulses shorter than MINIMUM_STEPPER_PULSE
+  - step periods faster than MAXIMUM_STEPPER_RATE
+
+plus the number of times Stepper::isr() ran out of loops (max_loops).
+
+Usage: step_analyzer.py [options] trace.bin
+
+Options:
+  --axis=NAME=PIN     step pin of an axis, repeatable. NAME is A, B, C or E
+                      (X, Y, Z also accepted). Default: the RAMPS_LINUX pins
+  --min-pulse=US      MINIMUM_STEPPER_PULSE in µs (default: 2)
+  --max-rate=HZ       MAXIMUM_STEPPER_RATE in Hz (default: no check)
+
+Exits with status 1 if any pulse, rate or ISR overrun problem was found.
+"""
+
+from __future__ import print_function, division
+
+import argparse
+import bisect
+import math
+import sys
+
+import gpio_trace as gt
+
+DEFAULT_AXES = 'A=54,B=60,C=46,E=26' # pins_RAMPS_LINUX.h X/Y/Z/E0_STEP_PIN
+AXIS_FIELD = { 'A': 'steps_a', 'X': 'steps_a', 'B': 'steps_b', 'Y': 'steps_b', 'C': 'steps_c', 'Z': 'steps_c', 'E': 'steps_e' }
+
+def planned_time(b, k):
+    """Time in seconds from the start of block b to step event k on the planned (continuous) trapezoid."""
+    a, v0, vn, vf = b['acceleration'], b['initial_rate'], b['nominal_rate'], b['final_rate']
+    au, da = b['accelerate_until'], b['decelerate_after']
+    if not a: return k / vn
+
+    def accel(v, n): # time to cover n steps from rate v
+        return (math.sqrt(v * v + 2 * a * n) - v) / a
+
+    vc = min(vn, math.sqrt(v0 * v0 + 2 * a * au))
+    if k <= au: return accel(v0, k)
+    t = accel(v0, au)
+    if k <= da: return t + (k - au) / vc
+    t += (da - au) / vc
+    n = k - da
+    nf = (vc * vc - vf * vf) / (2 * a) # steps until final_rate is reached
+    if n <= nf: return t + (vc - math.sqrt(vc * vc - 2 * a * n)) / a
+    return t + (vc - vf) / a + (n - nf) / vf
+
+def percentile(sorted_values, p):
+    if not sorted_values: return 0
+    return sorted_values[min(len(sorted_values) - 1, int(len(sorted_values) * p))]
+
+def rate_histogram(intervals):
+    """Count step rates in power-of-two buckets, keyed by the lower bound in Hz (0 for pauses under 1 Hz)."""
+    hist = {}
+    for dt in intervals:
+        if dt <= 0: continue
+        rate = 1e9 / dt
+        bucket = 1 << int(math.log2(rate)) if rate >= 1 else 0
+        hist[bucket] = hist.get(bucket, 0) + 1
+    return hist
+
+class Axis:
+    def __init__(self, name, pin):
+        self.name, self.pin = name, pin
+        self.rises, self.falls = [], []
+        self.errors = [] # actual - planned interval, ns
+
+def analyze(records, axes, min_pulse_ns, min_period_ns):
+    by_pin = dict((axis.pin, axis) for axis in axes)
+    blocks, overruns, lost = [], 0, 0
+    for ts, pin, event, value in records:
+        axis = by_pin.get(pin)
+        if axis and event in (gt.RISE, gt.FALL):
+            (axis.rises if event == gt.RISE else axis.falls).append(ts)
+        elif event == gt.BLOCK:
+            if pin == 0: blocks.append((ts, {}))
+            if blocks and pin < len(gt.BLOCK_FIELDS): blocks[-1][1][gt.BLOCK_FIELDS[pin]] = value
+        elif event == gt.ISR_OVERRUN:
+            overruns += value
+        elif event == gt.OVERFLOW:
+            lost += value
+
+    # Interval error of each axis in each block. The lead axis (stepping on every step
+    # event) ideally steps on event k + 1. A slower axis with s steps ideally steps where
+    # its Bresenham error term crosses zero, at event count * (2k + 1) / 2s.
+    for i, (start, b) in enumerate(blocks):
+        count = b.get('step_event_count', 0)
+        if len(b) < len(gt.BLOCK_FIELDS) or count < 2: continue
+        end = blocks[i + 1][0] if i + 1 < len(blocks) else float('inf')
+        for axis in axes:
+            s = b[AXIS_FIELD[axis.name[0]]]
+            if s < 2: continue
+            pos = (lambda k: k + 1) if s == count else (lambda k: count * (2 * k + 1) / (2 * s))
+            steps = axis.rises[bisect.bisect_left(axis.rises, start):bisect.bisect_left(axis.rises, end)]
+            for k in range(1, min(len(steps), s)):
+                axis.errors.append(steps[k] - steps[k - 1] - 1e9 * (planned_time(b, pos(k)) - planned_time(b, pos(k - 1))))
+
+    failed = False
+    print('%d blocks, %d stepper ISR overruns' % (len(blocks), overruns))
+    if lost: print('WARNING: %d trace events lost, results are incomplete' % lost)
+    failed |= overruns > 0
+
+    for axis in axes:
+        print('\nAxis %s (pin %d): %d steps' % (axis.name, axis.pin, len(axis.rises)))
+        if len(axis.rises) < 2: continue
+
+        intervals = [b - a for a, b in zip(axis.rises, axis.rises[1:])]
+        print('  Step rate histogram:')
+        hist = rate_histogram(intervals)
+        peak = max(hist.values())
+        for bucket in sorted(hist):
+            label = '%d-%d' % (bucket, bucket * 2) if bucket else '<1'
+            print('    %15s Hz %8d %s' % (label, hist[bucket], '#' * int(40 * hist[bucket] / peak)))
+
+        # Pair each rising edge with the next falling edge for the pulse width
+        widths, j = [], 0
+        for r in axis.rises:
+            j = bisect.bisect_right(axis.falls, r, j)
+            if j < len(axis.falls): widths.append(axis.falls[j] - r)
+        short = sum(1 for w in widths if w < min_pulse_ns)
+        fast = sum(1 for dt in intervals if dt < min_period_ns)
+        print('  Pulse width min %d ns, %d shorter than %d ns' % (min(widths) if widths else 0, short, min_pulse_ns))
+        print('  Step period min %d ns' % min(intervals) + (', %d shorter than %d ns' % (fast, min_period_ns) if min_period_ns else ''))
+        failed |= short > 0 or fast > 0
+
+        if axis.errors:
+            errs = sorted(abs(e) for e in axis.errors)
+            mean = sum(axis.errors) / len(axis.errors)
+            sd = math.sqrt(sum((e - mean) ** 2 for e in axis.errors) / len(axis.errors))
+            print('  Interval vs plan (%d intervals): mean %+.0f ns, stddev %.0f ns, p99 %.0f ns, max %.0f ns'
+                  % (len(errs), mean, sd, percentile(errs, 0.99), errs[-1]))
+
+    return failed
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='Analyze step pulse timing in a Linux simulator GPIO trace.')
+    parser.add_argument('trace')
+    parser.add_argument('--axis', action='append', help='NAME=STEP_PIN, e.g. A=54 (repeatable)')
+    parser.add_argument('--min-pulse', type=float, default=2, help='MINIMUM_STEPPER_PULSE in µs')
+    parser.add_argument('--max-rate', type=float, default=0, help='MAXIMUM_STEPPER_RATE in Hz')
+    args = parser.parse_args(argv)
+
+    axes = []
+    for spec in (args.axis or DEFAULT_AXES.split(',')):
+        name, _, pin = spec.partition('=')
+        if name.upper()[:1] not in AXIS_FIELD or not pin:
+            parser.error('bad --axis %s' % spec)
+        axes.append(Axis(name.upper(), int(pin)))
+
+    failed = analyze(gt.read_trace(args.trace), axes, args.min_pulse * 1000, 1e9 / args.max_rate if args.max_rate else 0)
+    return 1 if failed else 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))